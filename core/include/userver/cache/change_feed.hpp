@@ -0,0 +1,71 @@
+#pragma once
+
+/// @file userver/cache/change_feed.hpp
+/// @brief @copybrief cache::ChangeFeed
+
+#include <functional>
+#include <utility>
+
+#include <userver/cache/cache_update_trait.hpp>
+#include <userver/cache/update_type.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_base_classes
+///
+/// @brief Interface for storage-side change feeds driving incremental cache
+/// updates.
+///
+/// A storage driver (Postgres logical decoding, Mongo change streams, a
+/// pub/sub channel) implements this interface and invokes the registered
+/// callback whenever changed keys become available; the cache side reacts
+/// with an `Update(UpdateType::kIncremental)` that fetches only the changes
+/// instead of waiting for the next full-period update.
+///
+/// Implementations must tolerate callback invocations from their own
+/// internal threads/tasks; the cache-side callback is non-blocking.
+class ChangeFeed {
+ public:
+  ChangeFeed() = default;
+  ChangeFeed(const ChangeFeed&) = delete;
+  ChangeFeed& operator=(const ChangeFeed&) = delete;
+  virtual ~ChangeFeed() = default;
+
+  /// Starts delivering change notifications to `on_change`. The callback
+  /// outlives the feed until Stop() returns.
+  virtual void Start(std::function<void()> on_change) = 0;
+
+  /// Stops notifications; no callback runs after this returns.
+  virtual void Stop() noexcept = 0;
+};
+
+/// @brief RAII binding of a ChangeFeed to a cache: every notification
+/// triggers a non-blocking incremental update (InvalidateAsync coalesces
+/// bursts into pending update steps).
+class ChangeFeedSubscription final {
+ public:
+  ChangeFeedSubscription(ChangeFeed& feed, CacheUpdateTrait& cache)
+      : ChangeFeedSubscription(feed, [&cache] {
+          cache.InvalidateAsync(UpdateType::kIncremental);
+        }) {}
+
+  /// For custom reactions (and tests)
+  ChangeFeedSubscription(ChangeFeed& feed, std::function<void()> on_change)
+      : feed_(feed) {
+    feed_.Start(std::move(on_change));
+  }
+
+  ChangeFeedSubscription(const ChangeFeedSubscription&) = delete;
+  ChangeFeedSubscription& operator=(const ChangeFeedSubscription&) = delete;
+
+  ~ChangeFeedSubscription() { feed_.Stop(); }
+
+ private:
+  ChangeFeed& feed_;
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -90,6 +90,14 @@ class ExpirableLruCache final {
    */
   void SetBackgroundUpdate(BackgroundUpdateMode background_update);
 
+  /**
+   * Sets the refresh-ahead trigger: with background updates enabled, an
+   * entry starts revalidating once this percent of max_lifetime has
+   * elapsed (default 50). Readers keep getting the current value while the
+   * single-flight background fetch runs.
+   */
+  void SetBackgroundUpdatePercent(int percent);
+
   /**
    * @returns GetOptional("key", update_func) if it is not std::nullopt.
    * Otherwise the result of update_func(key) is returned, and additionally
@@ -164,6 +172,7 @@ class ExpirableLruCache final {
       std::chrono::milliseconds(0)};
   std::atomic<BackgroundUpdateMode> background_update_mode_{
       BackgroundUpdateMode::kDisabled};
+  std::atomic<int> background_update_percent_{50};
   impl::ExpirableLruCacheStatistics stats_;
   concurrent::MutexSet<Key, Hash, Equal> mutex_set_;
   utils::impl::WaitTokenStorage wait_token_storage_;
@@ -203,6 +212,13 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdate(
   background_update_mode_ = background_update;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdatePercent(
+    int percent) {
+  UASSERT(percent > 0 && percent < 100);
+  background_update_percent_ = percent;
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
     const Key& key, const UpdateValueFunc& update_func, ReadMode read_mode) {
@@ -379,7 +395,9 @@ bool ExpirableLruCache<Key, Value, Hash, Equal>::ShouldUpdate(
     std::chrono::steady_clock::time_point now) const {
   auto max_lifetime = max_lifetime_.load();
   return (background_update_mode_.load() == BackgroundUpdateMode::kEnabled) &&
-         max_lifetime.count() != 0 && update_time + max_lifetime / 2 < now;
+         max_lifetime.count() != 0 &&
+         update_time + max_lifetime * background_update_percent_.load() / 100 <
+             now;
 }
 
 template <typename Key, typename Value, typename Hash = std::hash<Key>,
@@ -30,6 +30,9 @@ struct LruCacheConfig final {
   std::size_t size;
   std::chrono::milliseconds lifetime;
   BackgroundUpdateMode background_update;
+  // refresh-ahead trigger: background update starts once this fraction of
+  // the lifetime has elapsed (percent, 1..99)
+  int background_update_percent{50};
 };
 
 LruCacheConfig Parse(const formats::json::Value& value,
@@ -0,0 +1,62 @@
+#pragma once
+
+/// @file userver/cache/partitioned_build.hpp
+/// @brief Helpers for sharding an expensive cache rebuild across tasks.
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief Runs `build_shard(shard_index, shard_count)` in `shard_count`
+/// parallel tasks and returns the per-shard results in shard order.
+///
+/// Intended for full cache updates that are CPU- or IO-parallelizable: each
+/// shard fetches and builds its own sub-map, the caller assembles the final
+/// snapshot (e.g. with MergePartitioned below) and publishes it atomically
+/// via Set()/rcu as usual. Exceptions of any shard propagate to the caller
+/// after all tasks finish or get cancelled.
+template <typename BuildShardFunc>
+auto BuildPartitioned(std::size_t shard_count, const std::string& name,
+                      BuildShardFunc build_shard) {
+  using Shard = decltype(build_shard(std::size_t{}, std::size_t{}));
+
+  std::vector<engine::TaskWithResult<Shard>> tasks;
+  tasks.reserve(shard_count);
+  for (std::size_t shard = 0; shard < shard_count; ++shard) {
+    tasks.push_back(utils::Async(name, [&build_shard, shard, shard_count] {
+      return build_shard(shard, shard_count);
+    }));
+  }
+
+  std::vector<Shard> results;
+  results.reserve(shard_count);
+  for (auto& task : tasks) {
+    results.push_back(task.Get());
+  }
+  return results;
+}
+
+/// @brief Merges per-shard maps into the first one without copies
+/// (container `merge()`), returning the assembled snapshot.
+template <typename Map>
+Map MergePartitioned(std::vector<Map>&& shards) {
+  if (shards.empty()) return Map{};
+
+  auto result = std::move(shards.front());
+  for (std::size_t i = 1; i < shards.size(); ++i) {
+    result.merge(shards[i]);
+  }
+  return result;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
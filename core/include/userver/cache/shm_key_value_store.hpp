@@ -0,0 +1,63 @@
+#pragma once
+
+/// @file userver/cache/shm_key_value_store.hpp
+/// @brief @copybrief cache::ShmKeyValueStore
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_caches
+///
+/// @brief A byte key/value store living in a named shared-memory segment,
+/// surviving binary restarts.
+///
+/// Intended for sidecar-style deployments as the warm-restart layer of a
+/// cache (the dump subsystem remains the cold-disk layer): the segment is
+/// opened-or-created by name, so after a restart the new process finds the
+/// previous contents and can serve without re-fetching, avoiding the
+/// post-deploy thundering herd.
+///
+/// All operations take an in-segment mutex and may fault pages in; treat
+/// them as blocking (use from an fs task processor on hot paths). The store
+/// is process-crash-safe only to the extent shared memory is: a writer
+/// dying inside an operation may leave the segment lock held, see Reset().
+class ShmKeyValueStore final {
+ public:
+  /// Opens or creates the named segment of the given byte size.
+  /// @throws std::runtime_error on shared-memory errors.
+  ShmKeyValueStore(const std::string& name, std::size_t segment_size);
+  ~ShmKeyValueStore();
+
+  ShmKeyValueStore(const ShmKeyValueStore&) = delete;
+  ShmKeyValueStore& operator=(const ShmKeyValueStore&) = delete;
+
+  std::optional<std::string> Get(std::string_view key) const;
+
+  /// @throws std::runtime_error when the segment is out of space.
+  void Put(std::string_view key, std::string_view value);
+
+  void Remove(std::string_view key);
+
+  std::size_t GetSize() const;
+
+  /// Free bytes left in the segment.
+  std::size_t GetFreeMemory() const;
+
+  /// Removes the named segment entirely; the next construction starts cold.
+  static void Reset(const std::string& name);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
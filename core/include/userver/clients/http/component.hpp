@@ -11,6 +11,7 @@
 #include <userver/components/loggable_component_base.hpp>
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
+#include <userver/utils/periodic_task.hpp>
 #include <userver/utils/statistics/entry.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -49,6 +50,9 @@ namespace components {
 /// set-deadline-propagation-header | whether to set http::common::kXYaTaxiClientTimeoutMs request header, see @ref scripts/docs/en/userver/deadline_propagation.md | true
 /// plugins | Plugin names to apply. A plugin component is called "http-client-plugin-" plus the plugin name. | []
 /// cancellation-policy | Cancellation policy for new requests. | cancel
+/// prewarm.destinations | URLs to pre-establish connections to at startup and maintain via a jittered background keeper | []
+/// prewarm.connections-per-destination | connections to keep established per pre-warmed destination | 1
+/// prewarm.keeper-interval | period of the background pool keeper | 15s
 ///
 /// ## Static configuration example:
 ///
@@ -74,6 +78,8 @@ class HttpClient final : public LoggableComponentBase {
 
   void WriteStatistics(utils::statistics::Writer& writer);
 
+  void PrewarmConnections();
+
   static std::vector<utils::NotNull<clients::http::Plugin*>> FindPlugins(
       const std::vector<std::string>& names,
       const components::ComponentContext& context);
@@ -82,6 +88,11 @@ class HttpClient final : public LoggableComponentBase {
   clients::http::Client http_client_;
   concurrent::AsyncEventSubscriberScope subscriber_scope_;
   utils::statistics::Entry statistics_holder_;
+
+  // Connection pool pre-warming, see the 'prewarm' static option
+  std::vector<std::string> prewarm_destinations_;
+  std::size_t prewarm_connections_{1};
+  utils::PeriodicTask prewarm_task_;
 };
 
 template <>
@@ -28,6 +28,12 @@ class PluginRequest final {
 
   void SetTimeout(std::chrono::milliseconds ms);
 
+  const std::string& GetOriginalUrl() const;
+
+  /// HookPerformRequest is invoked for every retry; this tells the attempts
+  /// apart.
+  bool IsFirstAttempt() const;
+
  private:
   RequestState& state_;
 };
@@ -51,8 +57,9 @@ class Plugin {
   ///        You might want to add custom tags from the hook.
   virtual void HookCreateSpan(PluginRequest& request) = 0;
 
-  /// @brief The hook is called after the HTTP response is received or the
-  ///        timeout is passed.
+  /// @brief The hook is called after the HTTP response is received, the
+  ///        timeout is passed or the request failed with an error; in the
+  ///        latter cases the response carries no status code and no headers.
   ///
   /// @warning The hook is called in libev thread, not in coroutine context! Do
   ///          not do any heavy work here, offload it to other hooks.
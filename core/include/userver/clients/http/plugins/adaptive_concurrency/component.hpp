@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+
+#include <userver/clients/http/plugin_component.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::adaptive_concurrency {
+
+class Plugin;
+
+// clang-format off
+
+/// @brief HTTP client plugin that applies a gradient-style adaptive
+/// concurrency limit per destination, fast-failing excess requests when a
+/// downstream browns out.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// min-limit | lower bound of the per-destination limit | 4
+/// max-limit | upper bound of the per-destination limit | 1024
+/// initial-limit | limit of a freshly seen destination | 64
+
+// clang-format on
+class Component final : public plugin::ComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of
+  /// clients::http::plugins::adaptive_concurrency::Component component
+  static constexpr std::string_view kName =
+      "http-client-plugin-adaptive-concurrency";
+
+  Component(const components::ComponentConfig&,
+            const components::ComponentContext&);
+
+  ~Component() override;
+
+  http::Plugin& GetPlugin() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::unique_ptr<adaptive_concurrency::Plugin> plugin_;
+};
+
+}  // namespace clients::http::plugins::adaptive_concurrency
+
+template <>
+inline constexpr bool components::kHasValidate<
+    clients::http::plugins::adaptive_concurrency::Component> = true;
+
+USERVER_NAMESPACE_END
@@ -34,6 +34,7 @@ class RequestState;
 class StreamedResponse;
 class ConnectTo;
 class Form;
+class RequestBodyStream;
 struct DeadlinePropagationConfig;
 class RequestStats;
 class DestinationStatistics;
@@ -157,6 +158,11 @@ class Request final {
   /// data for POST request
   Request& data(std::string data) &;
   Request data(std::string data) &&;
+  /// @brief Producer-driven chunked request body, see
+  /// clients::http::RequestBodyStream. Disables retries (a streamed body
+  /// cannot be rewound).
+  Request& body_stream(const RequestBodyStream& body) &;
+  Request body_stream(const RequestBodyStream& body) &&;
   /// form for POST request
   Request& form(Form&& form) &;
   Request form(Form&& form) &&;
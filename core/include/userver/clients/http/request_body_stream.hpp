@@ -0,0 +1,85 @@
+#pragma once
+
+/// @file userver/clients/http/request_body_stream.hpp
+/// @brief @copybrief clients::http::RequestBodyStream
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// @brief Producer-driven chunked request body, mirroring StreamedResponse
+/// on the upload side.
+///
+/// Create one, attach it to a request via Request::body_stream(), start the
+/// request asynchronously, then feed chunks from the producing coroutine and
+/// Close() when done. Chunks are uploaded as they arrive (chunked
+/// transfer-encoding), so large bodies are never buffered whole; PushChunk
+/// applies backpressure once the configured byte bound of queued data is
+/// reached.
+///
+/// Retries are disabled for requests with a streamed body: the body cannot
+/// be rewound.
+class RequestBodyStream final {
+ public:
+  /// @param max_queued_bytes byte bound of not-yet-uploaded chunks, the
+  /// backpressure window
+  explicit RequestBodyStream(std::size_t max_queued_bytes = 1 << 20);
+
+  /// @brief Queues a body chunk, waiting cooperatively while the byte bound
+  /// is full. Must be called from coroutine context.
+  /// @returns false when the request is gone (cancelled/destroyed) and the
+  /// body is no longer consumed.
+  [[nodiscard]] bool PushChunk(std::string chunk);
+
+  /// @brief Marks the end of the body. Mandatory: the transfer cannot
+  /// complete without it. No PushChunk calls are allowed afterwards.
+  void Close();
+
+  /// @cond
+  // Internal shared state, used by the request internals.
+  class State final {
+   public:
+    explicit State(std::size_t max_queued_bytes);
+
+    // producer side
+    bool Push(std::string&& chunk);
+    void Close();
+
+    // transfer side (ev thread): non-blocking
+    bool PopChunkNoblock(std::string& chunk);
+    bool IsClosed() const noexcept;
+
+    // Called by Push/Close to kick a paused transfer; armed at perform time.
+    void SetResumeHook(std::function<void()> hook);
+
+   private:
+    explicit State(std::shared_ptr<concurrent::StringStreamQueue> queue);
+
+    void NotifyResume();
+
+    concurrent::StringStreamQueue::Producer producer_;
+    concurrent::StringStreamQueue::Consumer consumer_;
+    std::atomic<bool> closed_{false};
+    std::mutex resume_mutex_;
+    std::function<void()> resume_;
+  };
+
+  std::shared_ptr<State> GetState() const noexcept { return state_; }
+  /// @endcond
+
+ private:
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
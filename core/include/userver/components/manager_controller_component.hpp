@@ -50,6 +50,9 @@ class Manager;
 /// worker_threads | threads count for the task processor | -
 /// os-scheduling | OS scheduling mode for the task processor threads. 'idle' sets the lowest priority. 'low-priority' sets the priority below 'normal' but higher than 'idle'. | normal
 /// spinning-iterations | tunes the number of spin-wait iterations in case of an empty task queue before threads go to sleep | 1000
+/// adaptive-spinning | makes spinning-iterations an upper bound of an adaptive spin budget that grows on bursty task arrivals and decays to zero when the queue is idle | false
+/// cpu-affinity | explicit CPU ids to pin the worker threads to; takes precedence over numa-node | []
+/// numa-node | NUMA node to pin the worker threads to, so that coroutine stacks and run-queue entries stay node-local; -1 disables pinning | -1
 /// task-trace | optional dictionary of tracing options | empty (disabled)
 /// task-trace.every | set N to trace each Nth task | 1000
 /// task-trace.max-context-switch-count | set upper limit of context switches to trace for a single task | 1000
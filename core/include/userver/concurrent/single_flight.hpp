@@ -0,0 +1,110 @@
+#pragma once
+
+/// @file userver/concurrent/single_flight.hpp
+/// @brief @copybrief concurrent::SingleFlight
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/shared_task_with_result.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+/// @ingroup userver_concurrency
+///
+/// @brief Deduplicates concurrent computations per key ("dogpile"
+/// protection): the first caller starts the computation, concurrent callers
+/// for the same key attach to the same in-flight task and share its result,
+/// so a cache-expiry storm costs one downstream fetch per key instead of
+/// one per waiter.
+///
+/// ## Example usage:
+///
+/// @snippet src/concurrent/single_flight_test.cpp  Sample SingleFlight usage
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class SingleFlight final {
+ public:
+  /// @brief Returns the result of `compute()`, running it at most once
+  /// across all concurrent callers with the same key. Exceptions propagate
+  /// to every waiter; the key is retired when the computation finishes, so
+  /// later calls compute afresh.
+  template <typename ComputeFunc>
+  Value Do(const Key& key, ComputeFunc&& compute) {
+    auto [task, generation] =
+        StartOrAttach(key, std::forward<ComputeFunc>(compute));
+    try {
+      auto result = task.Get();
+      Retire(key, generation);
+      return result;
+    } catch (...) {
+      // A cancelled waiter must not retire a computation that keeps running
+      // for the other waiters; a stale finished entry left by all-cancelled
+      // waiters is cleaned up on the next StartOrAttach.
+      if (task.IsFinished()) Retire(key, generation);
+      throw;
+    }
+  }
+
+  /// Number of computations currently in flight.
+  std::size_t GetInFlightCount() {
+    std::lock_guard lock(mutex_);
+    return in_flight_.size();
+  }
+
+ private:
+  using SharedTask = engine::SharedTaskWithResult<Value>;
+
+  struct InFlight final {
+    SharedTask task;
+    // Tells entries of successive computations of one key apart, so that a
+    // late waiter of a finished computation never retires a newer one.
+    std::uint64_t generation;
+  };
+
+  template <typename ComputeFunc>
+  std::pair<SharedTask, std::uint64_t> StartOrAttach(const Key& key,
+                                                     ComputeFunc&& compute) {
+    std::lock_guard lock(mutex_);
+    auto it = in_flight_.find(key);
+    if (it != in_flight_.end()) {
+      if (!it->second.task.IsFinished()) {
+        return {it->second.task, it->second.generation};
+      }
+      // finished entry whose waiters were all cancelled before retiring
+      in_flight_.erase(it);
+    }
+
+    auto task = utils::SharedAsync(
+        "single-flight",
+        [compute = std::forward<ComputeFunc>(compute)]() mutable {
+          return compute();
+        });
+    const auto generation = ++generation_counter_;
+    in_flight_.emplace(key, InFlight{task, generation});
+    return {std::move(task), generation};
+  }
+
+  void Retire(const Key& key, std::uint64_t generation) noexcept {
+    std::lock_guard lock(mutex_);
+    const auto it = in_flight_.find(key);
+    if (it != in_flight_.end() && it->second.generation == generation) {
+      in_flight_.erase(it);
+    }
+  }
+
+  engine::Mutex mutex_;
+  std::uint64_t generation_counter_{0};
+  std::unordered_map<Key, InFlight, Hash, Equal> in_flight_;
+};
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
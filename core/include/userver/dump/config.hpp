@@ -45,6 +45,9 @@ struct Config final {
   std::optional<std::chrono::milliseconds> max_dump_age;
   bool max_dump_age_set;
   bool dump_is_encrypted;
+  bool dump_is_compressed;
+  // bytes per second, 0 means unlimited
+  std::size_t max_write_bandwidth_bps;
 
   bool static_dumps_enabled;
   std::chrono::milliseconds static_min_dump_interval;
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+/// Paces dump writes to at most `max_bandwidth_bps` bytes per second by
+/// sleeping the current task between chunks. 0 means unlimited.
+class WriteBandwidthThrottle final {
+ public:
+  explicit WriteBandwidthThrottle(std::size_t max_bandwidth_bps);
+
+  /// Accounts for `bytes_written` more bytes on disk and sleeps if the
+  /// write rate exceeds the cap
+  void OnBytesWritten(std::size_t bytes_written);
+
+ private:
+  const std::size_t max_bandwidth_bps_;
+  std::chrono::steady_clock::time_point window_start_;
+  std::size_t bytes_in_window_{0};
+};
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// A handle to a gzip-compressed dump file with streaming (de)compression.
+/// File operations block the thread. Enable via `compressed: true` in the
+/// dump config.
+class CompressedWriter final : public Writer {
+ public:
+  /// @brief Creates a new compressed dump file and opens it
+  /// @param max_bandwidth_bps caps the rate of compressed bytes hitting the
+  /// disk, bytes per second, 0 means unlimited
+  /// @throws `Error` on a filesystem error
+  CompressedWriter(std::string path, boost::filesystem::perms perms,
+                   tracing::ScopeTime& scope,
+                   std::size_t max_bandwidth_bps = 0);
+  ~CompressedWriter() override;
+
+  void Finish() override;
+
+ private:
+  void WriteRaw(std::string_view data) override;
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// A handle to a gzip-compressed dump file, decompressed while streaming.
+class CompressedReader final : public Reader {
+ public:
+  /// @brief Opens an existing compressed dump file
+  /// @throws `Error` on a filesystem error
+  explicit CompressedReader(std::string path);
+  ~CompressedReader() override;
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+class CompressedOperationsFactory final : public OperationsFactory {
+ public:
+  explicit CompressedOperationsFactory(boost::filesystem::perms perms,
+                                       std::size_t max_write_bandwidth_bps = 0);
+
+  std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+  std::unique_ptr<Writer> CreateWriter(std::string full_path,
+                                       tracing::ScopeTime& scope) override;
+
+ private:
+  const boost::filesystem::perms perms_;
+  const std::size_t max_write_bandwidth_bps_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 #include <boost/filesystem/operations.hpp>
 
 #include <userver/dump/factory.hpp>
@@ -16,9 +18,12 @@ using SecretKey = utils::NonLoggable<class SecretKeyTag, std::string>;
 class EncryptedWriter final : public Writer {
  public:
   /// @brief Creates a new dump file and opens it
+  /// @param max_bandwidth_bps caps the write rate, bytes per second,
+  /// 0 means unlimited
   /// @throws `Error` on a filesystem error
   EncryptedWriter(std::string filename, const SecretKey& secret_key,
-                  boost::filesystem::perms, tracing::ScopeTime& scope);
+                  boost::filesystem::perms, tracing::ScopeTime& scope,
+                  std::size_t max_bandwidth_bps = 0);
 
   ~EncryptedWriter() override;
 
@@ -28,7 +33,7 @@ class EncryptedWriter final : public Writer {
   void WriteRaw(std::string_view data) override;
 
   struct Impl;
-  utils::FastPimpl<Impl, 632, 8> impl_;
+  utils::FastPimpl<Impl, 656, 8> impl_;
 };
 
 class EncryptedReader final : public Reader {
@@ -51,7 +56,8 @@ class EncryptedReader final : public Reader {
 class EncryptedOperationsFactory final : public OperationsFactory {
  public:
   EncryptedOperationsFactory(SecretKey&& secret_key,
-                             boost::filesystem::perms perms);
+                             boost::filesystem::perms perms,
+                             std::size_t max_write_bandwidth_bps = 0);
 
   std::unique_ptr<Reader> CreateReader(std::string full_path) override;
 
@@ -61,6 +67,7 @@ class EncryptedOperationsFactory final : public OperationsFactory {
  private:
   const SecretKey secret_key_;
   const boost::filesystem::perms perms_;
+  const std::size_t max_write_bandwidth_bps_;
 };
 
 }  // namespace dump
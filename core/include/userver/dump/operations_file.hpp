@@ -1,7 +1,5 @@
 #pragma once
 
-#include <chrono>
-
 #include <boost/filesystem/operations.hpp>
 
 #include <userver/fs/blocking/c_file.hpp>
@@ -9,6 +7,7 @@
 #include <userver/utils/fast_pimpl.hpp>
 
 #include <userver/dump/factory.hpp>
+#include <userver/dump/impl/write_bandwidth_throttle.hpp>
 #include <userver/dump/operations.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -19,9 +18,12 @@ namespace dump {
 class FileWriter final : public Writer {
  public:
   /// @brief Creates a new dump file and opens it
+  /// @param max_bandwidth_bps caps the write rate in bytes per second by
+  /// sleeping between chunks, 0 means unlimited
   /// @throws `Error` on a filesystem error
   explicit FileWriter(std::string path, boost::filesystem::perms perms,
-                      tracing::ScopeTime& scope);
+                      tracing::ScopeTime& scope,
+                      std::size_t max_bandwidth_bps = 0);
 
   void Finish() override;
 
@@ -33,6 +35,7 @@ class FileWriter final : public Writer {
   std::string path_;
   boost::filesystem::perms perms_;
   utils::StreamingCpuRelax cpu_relax_;
+  impl::WriteBandwidthThrottle throttle_;
 };
 
 /// A handle to a dump file. File operations block the thread.
@@ -54,7 +57,8 @@ class FileReader final : public Reader {
 
 class FileOperationsFactory final : public OperationsFactory {
  public:
-  explicit FileOperationsFactory(boost::filesystem::perms perms);
+  explicit FileOperationsFactory(boost::filesystem::perms perms,
+                                 std::size_t max_write_bandwidth_bps = 0);
 
   std::unique_ptr<Reader> CreateReader(std::string full_path) override;
 
@@ -63,6 +67,7 @@ class FileOperationsFactory final : public OperationsFactory {
 
  private:
   const boost::filesystem::perms perms_;
+  const std::size_t max_write_bandwidth_bps_;
 };
 
 }  // namespace dump
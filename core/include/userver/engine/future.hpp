@@ -7,6 +7,7 @@
 #include <exception>
 #include <future>
 #include <memory>
+#include <type_traits>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future_status.hpp>
@@ -101,6 +102,20 @@ class Future final {
   /// @throw std::future_error if Future holds no state.
   FutureStatus wait_until(Deadline deadline) const;
 
+  /// @brief Attaches a continuation that runs inline instead of waking a
+  /// waiting task through the scheduler.
+  ///
+  /// The continuation is invoked with the ready Future exactly once: either
+  /// immediately (if the value is already available) or on the thread that
+  /// completes the Promise. This skips the run-queue round-trip of wait() +
+  /// get(), which matters when fanning out many sub-requests.
+  ///
+  /// @warning The continuation must be fast, must not block and must not
+  /// throw: it runs on the producer's thread in the producer's task context.
+  /// @throw std::future_error if Future holds no state.
+  template <typename Func>
+  void Then(Func&& continuation) &&;
+
   /// @cond
   // Internal helper for WaitAny/WaitAll
   impl::ContextAccessor* TryGetContextAccessor() noexcept {
@@ -217,6 +232,30 @@ FutureStatus Future<T>::wait_until(Deadline deadline) const {
   return state_->WaitUntil(deadline);
 }
 
+template <typename T>
+template <typename Func>
+void Future<T>::Then(Func&& continuation) && {
+  CheckValid();
+
+  class Continuation final : public impl::FutureContinuation {
+   public:
+    Continuation(Future&& future, Func&& func)
+        : future_(std::move(future)), func_(std::forward<Func>(func)) {}
+
+    void Run() noexcept override { std::move(func_)(std::move(future_)); }
+
+   private:
+    Future future_;
+    std::remove_reference_t<Func> func_;
+  };
+
+  // Keep the state alive until SetContinuation returns: *this is consumed by
+  // the continuation object, which may run and be destroyed concurrently.
+  const auto state = state_;
+  state->SetContinuation(std::make_unique<Continuation>(
+      std::move(*this), std::forward<Func>(continuation)));
+}
+
 template <typename T>
 Future<T>::Future(std::shared_ptr<impl::FutureState<T>> state)
     : state_(std::move(state)) {
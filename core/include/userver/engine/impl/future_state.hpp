@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <exception>
+#include <memory>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future_status.hpp>
@@ -13,6 +14,16 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+// Type-erased inline continuation of a Future, see Future::Then.
+class FutureContinuation {
+ public:
+  virtual ~FutureContinuation() = default;
+
+  // Runs on the thread that made the future ready (or inline at Then time if
+  // the future is already ready). Must not block or throw.
+  virtual void Run() noexcept = 0;
+};
+
 class FutureStateBase : private ContextAccessor {
  public:
   bool IsReady() const noexcept final;
@@ -22,6 +33,11 @@ class FutureStateBase : private ContextAccessor {
   void OnFutureCreated();
   bool IsFutureCreated() const noexcept;
 
+  // Attaches a continuation that is executed inline: immediately if the
+  // result is already set, otherwise on the completing thread right after
+  // the result is published. At most one continuation per state.
+  void SetContinuation(std::unique_ptr<FutureContinuation>&& continuation);
+
   // Internal helper for WaitAny/WaitAll
   ContextAccessor* TryGetContextAccessor() noexcept { return this; }
 
@@ -36,14 +52,21 @@ class FutureStateBase : private ContextAccessor {
  private:
   friend class FutureWaitStrategy<FutureStateBase>;
 
+  enum class ContinuationState { kNone, kSet, kDone };
+
   EarlyWakeup TryAppendWaiter(TaskContext& waiter) final;
   void RemoveWaiter(TaskContext& waiter) noexcept final;
   void AfterWait() noexcept final;
 
+  void TryRunContinuation() noexcept;
+
   FastPimplWaitListLight finish_waiters_;
   std::atomic<bool> is_ready_;
   std::atomic<bool> is_result_store_locked_;
   std::atomic<bool> is_future_created_;
+
+  std::unique_ptr<FutureContinuation> continuation_;
+  std::atomic<ContinuationState> continuation_state_{ContinuationState::kNone};
 };
 
 template <typename T>
@@ -5,6 +5,7 @@
 
 #include <functional>
 #include <string>
+#include <string_view>
 
 #include <userver/compiler/select.hpp>
 #include <userver/engine/deadline.hpp>
@@ -72,6 +73,17 @@ class BufferedReader final {
   /// Discards the specified number of bytes from the buffer.
   void Discard(size_t num_bytes, Deadline deadline = {});
 
+  /// @brief Ensures that at least `min_bytes` are buffered (or EOF is
+  /// reached) and returns a zero-copy view of everything buffered, so
+  /// parsers can work in-place instead of copying through ReadSome.
+  /// @warning The view is invalidated by any subsequent operation on the
+  /// reader.
+  std::string_view PeekAvailable(size_t min_bytes, Deadline deadline = {});
+
+  /// @brief Drops exactly `num_bytes` already-buffered bytes, as previously
+  /// observed via PeekAvailable. Never reads from the source.
+  void Consume(size_t num_bytes) noexcept;
+
  private:
   size_t FillBuffer(Deadline deadline);
 
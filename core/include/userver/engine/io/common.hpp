@@ -74,9 +74,20 @@ class WritableBase {
 
   [[nodiscard]] virtual size_t WriteAll(std::initializer_list<IoData> list,
                                         Deadline deadline) {
+    return WriteAll(list.begin(), list.size(), deadline);
+  }
+
+  /// @brief Sends exactly list_size chunks as if they were concatenated.
+  /// Allows runtime-sized iovec chains, e.g. a response built from header
+  /// fragments and body parts.
+  /// @note The default implementation writes the chunks one by one; socket
+  /// streams override it with a single scatter-gather syscall.
+  [[nodiscard]] virtual size_t WriteAll(const IoData* list,
+                                        std::size_t list_size,
+                                        Deadline deadline) {
     size_t result{0};
-    for (const auto& io_data : list) {
-      result += WriteAll(io_data.data, io_data.len, deadline);
+    for (std::size_t i = 0; i < list_size; ++i) {
+      result += WriteAll(list[i].data, list[i].len, deadline);
     }
     return result;
   }
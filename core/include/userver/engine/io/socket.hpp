@@ -172,6 +172,13 @@ class [[nodiscard]] Socket final : public RwBase {
     return SendAll(buf, len, deadline);
   }
 
+  /// @brief Writes a runtime-sized iovec chain with scatter-gather syscalls.
+  /// @note Can return less than the total size if socket is closed by peer.
+  [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size,
+                                Deadline deadline) override {
+    return SendAll(list, list_size, deadline);
+  }
+
  private:
   AddrDomain domain_{AddrDomain::kUnspecified};
 
@@ -15,6 +15,17 @@ namespace engine {
 /// other tasks to execute
 void Yield();
 
+/// @brief Yields only when the current task has been running for at least
+/// `slice_budget` since its last scheduling point, otherwise a cheap no-op
+/// (one coarse clock read).
+///
+/// Sprinkle into CPU-bound loops instead of unconditional engine::Yield
+/// calls: neighbors on the task processor stop starving, while short
+/// iterations pay no context switches.
+/// @returns whether a yield happened.
+bool YieldIfSliceExceeded(
+    std::chrono::milliseconds slice_budget = std::chrono::milliseconds{3});
+
 /// @cond
 /// Recursion stoppers/specializations
 void InterruptibleSleepUntil(Deadline);
@@ -0,0 +1,107 @@
+#pragma once
+
+/// @file userver/engine/task/task_local_arena.hpp
+/// @brief @copybrief engine::TaskLocalArena
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief A per-task bump-pointer arena for objects that die with the task.
+///
+/// Hands out memory from geometrically growing chunks; individual
+/// deallocations are no-ops and all memory is released wholesale when the
+/// task finishes. Intended for request-scoped allocations (header maps, JSON
+/// nodes, temporary strings).
+///
+/// Where the standard library provides `<memory_resource>`, the arena is
+/// usable with pmr containers:
+///
+/// @code
+/// auto& arena = engine::TaskLocalArena::OfCurrentTask();
+/// std::pmr::vector<int> numbers{&arena.GetMemoryResource()};
+/// @endcode
+///
+/// Not thread-safe: the arena must only be used from its own task.
+class TaskLocalArena final {
+ public:
+  /// @brief Returns the arena of the current task, creating it on first use.
+  /// @note Must be called from a coroutine, otherwise it is UB.
+  static TaskLocalArena& OfCurrentTask();
+
+  /// @brief Hands out `bytes` of task-lifetime memory.
+  void* Allocate(std::size_t bytes,
+                 std::size_t alignment = alignof(std::max_align_t));
+
+  /// Total bytes handed out by this arena so far.
+  std::size_t GetAllocatedBytes() const noexcept { return allocated_bytes_; }
+
+  /// @cond
+  // For internal use by the task-local storage only.
+  TaskLocalArena() = default;
+  /// @endcond
+  ~TaskLocalArena();
+
+  TaskLocalArena(const TaskLocalArena&) = delete;
+  TaskLocalArena& operator=(const TaskLocalArena&) = delete;
+
+#ifdef __cpp_lib_memory_resource
+  /// std::pmr::memory_resource adapter, suitable for pmr containers and
+  /// formats:: builders.
+  std::pmr::memory_resource& GetMemoryResource() noexcept { return resource_; }
+#endif
+
+ private:
+  struct Chunk final {
+    Chunk* previous{nullptr};
+    std::size_t size{0};
+    std::size_t used{0};
+    // chunk memory follows the header
+  };
+
+  void* TryAllocateInChunk(std::size_t bytes, std::size_t alignment) noexcept;
+  void AddChunk(std::size_t min_payload_size);
+
+  Chunk* head_chunk_{nullptr};
+  std::size_t next_chunk_size_{0};
+  std::size_t allocated_bytes_{0};
+
+#ifdef __cpp_lib_memory_resource
+  class ResourceAdapter final : public std::pmr::memory_resource {
+   public:
+    explicit ResourceAdapter(TaskLocalArena& arena) noexcept : arena_(arena) {}
+
+   private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+      return arena_.Allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) override {
+      // bump-pointer arena: freed wholesale at task exit
+    }
+
+    bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override {
+      return this == &other;
+    }
+
+    TaskLocalArena& arena_;
+  };
+
+  ResourceAdapter resource_{*this};
+#endif
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
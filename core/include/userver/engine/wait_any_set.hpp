@@ -0,0 +1,113 @@
+#pragma once
+
+/// @file userver/engine/wait_any_set.hpp
+/// @brief @copybrief engine::WaitAnySet
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/utils/meta.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+
+class ContextAccessor;
+
+// Debug-only check, see DoWaitAny
+void AssertWaitAnyTargetsUnique(utils::span<ContextAccessor* const> targets);
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief A reusable multi-wait object for repeated engine::WaitAny calls
+/// over the same set of tasks/futures.
+///
+/// A plain WaitAny call re-extracts the targets, re-verifies their
+/// uniqueness and rebuilds its bookkeeping on every invocation; in code that
+/// loops over WaitAny (hedged requests, streaming joins) this shows up in
+/// profiles. WaitAnySet does that setup once and keeps the target array
+/// alive across waits.
+///
+/// The tasks/futures must outlive the WaitAnySet. Unlike a plain WaitAny
+/// call, the set keeps pointers to the targets' shared states: after
+/// consuming a result (Future::get, Task::Get) the entry MUST be removed
+/// from the set via Remove(), otherwise the next wait would either report
+/// the consumed entry again or touch a destroyed state.
+///
+/// ## Example usage:
+///
+/// @snippet engine/wait_any_test.cpp sample waitanyset
+class WaitAnySet final {
+ public:
+  /// Builds the wait set from a pack of future-like elements.
+  template <typename... Tasks>
+  explicit WaitAnySet(Tasks&... tasks);
+
+  /// Builds the wait set from a container of future-like elements.
+  template <typename Container>
+  static WaitAnySet FromContainer(Container& tasks);
+
+  WaitAnySet(const WaitAnySet&) = delete;
+  WaitAnySet(WaitAnySet&&) noexcept = default;
+  WaitAnySet& operator=(const WaitAnySet&) = delete;
+  WaitAnySet& operator=(WaitAnySet&&) noexcept = default;
+
+  /// @brief Waits for the completion of any of the tasks of the set.
+  /// @returns the index of a completed task, or `std::nullopt` if there are
+  /// no completed tasks (possible if the current task was cancelled).
+  std::optional<std::size_t> WaitAny() { return WaitAnyUntil(Deadline{}); }
+
+  /// @overload
+  template <typename Rep, typename Period>
+  std::optional<std::size_t> WaitAnyFor(
+      const std::chrono::duration<Rep, Period>& duration) {
+    return WaitAnyUntil(Deadline::FromDuration(duration));
+  }
+
+  /// @overload
+  std::optional<std::size_t> WaitAnyUntil(Deadline deadline);
+
+  /// @brief Excludes the entry from further waits. Must be called right
+  /// after consuming the entry's result; the indices of other entries do not
+  /// change.
+  void Remove(std::size_t index) noexcept {
+    if (index < targets_.size()) targets_[index] = nullptr;
+  }
+
+  /// Number of entries in the set, including removed ones.
+  std::size_t GetSize() const noexcept { return targets_.size(); }
+
+ private:
+  WaitAnySet() = default;
+
+  std::vector<impl::ContextAccessor*> targets_;
+};
+
+template <typename... Tasks>
+WaitAnySet::WaitAnySet(Tasks&... tasks) {
+  targets_.reserve(sizeof...(Tasks));
+  (targets_.push_back(tasks.TryGetContextAccessor()), ...);
+  impl::AssertWaitAnyTargetsUnique(targets_);
+}
+
+template <typename Container>
+WaitAnySet WaitAnySet::FromContainer(Container& tasks) {
+  WaitAnySet result;
+  result.targets_.reserve(std::size(tasks));
+  for (auto& task : tasks) {
+    result.targets_.push_back(task.TryGetContextAccessor());
+  }
+  impl::AssertWaitAnyTargetsUnique(result.targets_);
+  return result;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,100 @@
+#pragma once
+
+/// @file userver/rcu/coalescing_writer.hpp
+/// @brief @copybrief rcu::CoalescingWriter
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/periodic_task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu {
+
+/// @ingroup userver_concurrency
+///
+/// @brief Coalesces frequent rcu::Variable writes into at most one
+/// publication per window.
+///
+/// Every Assign on an rcu::Variable allocates a snapshot and retires the
+/// previous one against all active readers; with high write frequency the
+/// retirement bookkeeping becomes measurable. CoalescingWriter buffers the
+/// latest pending value and publishes it at most once per window (plus a
+/// periodic flush for the trailing write), so bursts of updates cost one
+/// snapshot. Readers may observe values up to `window` late; call Flush()
+/// where immediate visibility matters.
+template <typename T>
+class CoalescingWriter final {
+ public:
+  CoalescingWriter(Variable<T>& variable, std::chrono::milliseconds window,
+                   std::string task_name = "rcu-coalescing-writer")
+      : variable_(variable), window_(window) {
+    flush_task_.Start(std::move(task_name),
+                      utils::PeriodicTask::Settings{window_},
+                      [this] { Flush(); });
+  }
+
+  CoalescingWriter(const CoalescingWriter&) = delete;
+  CoalescingWriter& operator=(const CoalescingWriter&) = delete;
+
+  ~CoalescingWriter() {
+    flush_task_.Stop();
+    Flush();
+  }
+
+  /// Buffers the value; it becomes visible with the next publication slot
+  /// (immediately if the window since the last publication has passed).
+  void Assign(T value) {
+    std::unique_lock lock(mutex_);
+    pending_.emplace(std::move(value));
+
+    const auto now = std::chrono::steady_clock::now();
+    if (now - last_publish_ >= window_) {
+      PublishLocked(lock, now);
+    }
+  }
+
+  /// Publishes the pending value right away, if any.
+  void Flush() {
+    std::unique_lock lock(mutex_);
+    if (pending_) {
+      PublishLocked(lock, std::chrono::steady_clock::now());
+    }
+  }
+
+ private:
+  void PublishLocked(std::unique_lock<engine::Mutex>& lock,
+                     std::chrono::steady_clock::time_point now) {
+    auto value = std::move(*pending_);
+    pending_.reset();
+    last_publish_ = now;
+    // Serializes concurrent publications in take-order, so a slow Assign of
+    // an older value can never overwrite a newer one; acquired under mutex_
+    // (consistent lock order), released after the rcu publication. Both
+    // mutexes are engine::Mutex: Assign may suspend on the rcu writer lock
+    // and resume on another thread, which a std::mutex must not be held
+    // across.
+    std::unique_lock publish_lock(publish_mutex_);
+    lock.unlock();
+    variable_.Assign(std::move(value));
+  }
+
+  Variable<T>& variable_;
+  const std::chrono::milliseconds window_;
+
+  engine::Mutex publish_mutex_;
+  engine::Mutex mutex_;
+  std::optional<T> pending_;
+  std::chrono::steady_clock::time_point last_publish_{};
+  utils::PeriodicTask flush_task_;
+};
+
+}  // namespace rcu
+
+USERVER_NAMESPACE_END
@@ -53,6 +53,9 @@ class HttpResponse final : public request::ResponseBase {
 
   void SetSendFailed(
       std::chrono::steady_clock::time_point failure_time) override;
+
+  void MarkBufferedSendFailed(
+      std::chrono::steady_clock::time_point failure_time) override;
   /// @endcond
 
   /// @brief Add a new response header or rewrite an existing one.
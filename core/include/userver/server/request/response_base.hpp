@@ -63,6 +63,11 @@ class ResponseBase {
   void SetReady(std::chrono::steady_clock::time_point now);
   virtual void SetSendFailed(
       std::chrono::steady_clock::time_point failure_time);
+
+  // For responses already serialized into a write buffer (and thus marked
+  // sent) whose actual socket write failed afterwards.
+  virtual void MarkBufferedSendFailed(
+      std::chrono::steady_clock::time_point failure_time);
   bool IsLimitReached() const;
 
   bool IsReady() const { return is_ready_; }
@@ -22,6 +22,14 @@ class Tracer : public std::enable_shared_from_this<Tracer> {
   static void SetNoLogSpans(NoLogSpans&& spans);
   static bool IsNoLogSpan(const std::string& name);
 
+  /// @brief Head-based sampling: the fraction (0..1) of new traces whose
+  /// spans are logged; unsampled traces skip span serialization entirely.
+  /// Spans tagged with an error escalate back to logging regardless.
+  static void SetSampleRate(double rate) noexcept;
+
+  /// Sampling decision for a freshly started trace (no parent span).
+  static bool ShouldSampleNewTrace() noexcept;
+
   static void SetTracer(TracerPtr tracer);
 
   static TracerPtr GetTracer();
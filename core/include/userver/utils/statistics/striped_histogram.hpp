@@ -0,0 +1,49 @@
+#pragma once
+
+/// @file userver/utils/statistics/striped_histogram.hpp
+/// @brief @copybrief utils::statistics::StripedHistogram
+
+#include <vector>
+
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/span.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @ingroup userver_concurrency
+///
+/// @brief A drop-in Histogram recorder with per-thread bucket striping.
+///
+/// Histogram::Account is an atomic increment on a shared bucket array; with
+/// dozens of workers recording per-request timings the cacheline contention
+/// becomes measurable. StripedHistogram spreads recordings over
+/// thread-indexed shards and merges them at scrape time, trading a constant
+/// factor of memory for contention-free recording.
+class StripedHistogram final {
+ public:
+  /// Sets upper bounds for each non-"infinite" bucket, see Histogram
+  explicit StripedHistogram(utils::span<const double> upper_bounds);
+
+  StripedHistogram(const StripedHistogram&) = delete;
+  StripedHistogram& operator=(const StripedHistogram&) = delete;
+
+  /// Increments the bucket of the calling thread's shard.
+  void Account(double value, std::uint64_t count = 1) noexcept;
+
+  /// Merges all shards into a snapshot Histogram (scrape-time operation).
+  Histogram Collapse() const;
+
+ private:
+  std::vector<double> upper_bounds_;
+  utils::FixedArray<Histogram> shards_;
+};
+
+void DumpMetric(Writer& writer, const StripedHistogram& histogram);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
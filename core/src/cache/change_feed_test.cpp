@@ -0,0 +1,50 @@
+#include <userver/cache/change_feed.hpp>
+
+#include <atomic>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class FakeFeed final : public cache::ChangeFeed {
+ public:
+  void Start(std::function<void()> on_change) override {
+    on_change_ = std::move(on_change);
+  }
+
+  void Stop() noexcept override { on_change_ = nullptr; }
+
+  void EmitChange() {
+    if (on_change_) on_change_();
+  }
+
+  bool IsStarted() const { return static_cast<bool>(on_change_); }
+
+ private:
+  std::function<void()> on_change_;
+};
+
+}  // namespace
+
+UTEST(CacheChangeFeed, SubscriptionLifecycle) {
+  FakeFeed feed;
+  std::atomic<int> triggered{0};
+
+  {
+    const cache::ChangeFeedSubscription subscription{
+        feed, [&triggered] { ++triggered; }};
+    EXPECT_TRUE(feed.IsStarted());
+
+    feed.EmitChange();
+    feed.EmitChange();
+    EXPECT_EQ(triggered.load(), 2);
+  }
+
+  EXPECT_FALSE(feed.IsStarted());
+  feed.EmitChange();  // no subscriber, no crash
+  EXPECT_EQ(triggered.load(), 2);
+}
+
+USERVER_NAMESPACE_END
@@ -61,6 +61,13 @@ properties:
         type: boolean
         description: enables asynchronous updates for expring values
         defaultDescription: false
+    background-update-fraction:
+        type: number
+        description: |
+            refresh-ahead trigger; a background revalidation of an entry
+            starts once this fraction of its lifetime has elapsed, while
+            readers keep getting the current value. Exclusive (0, 1)
+        defaultDescription: 0.5
     config-settings:
         type: boolean
         description: enables dynamic reconfiguration with CacheConfigSet
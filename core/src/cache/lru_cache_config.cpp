@@ -1,5 +1,6 @@
 #include <userver/cache/lru_cache_config.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 
 #include <userver/components/component_config.hpp>
@@ -17,8 +18,20 @@ constexpr std::string_view kWays = "ways";
 constexpr std::string_view kSize = "size";
 constexpr std::string_view kLifetime = "lifetime";
 constexpr std::string_view kBackgroundUpdate = "background-update";
+constexpr std::string_view kBackgroundUpdateFraction =
+    "background-update-fraction";
 constexpr std::string_view kLifetimeMs = "lifetime-ms";
 
+int ParseBackgroundUpdatePercent(double fraction) {
+  if (fraction <= 0.0 || fraction >= 1.0) {
+    throw std::runtime_error(
+        "background-update-fraction must be in (0, 1) exclusive");
+  }
+  // a schema-valid fraction like 0.005 would truncate to 0 ("refresh on
+  // every hit") and trip the [1, 99] contract of SetBackgroundUpdatePercent
+  return std::clamp(static_cast<int>(fraction * 100), 1, 99);
+}
+
 }  // namespace
 
 using dump::impl::ParseMs;
@@ -28,7 +41,9 @@ LruCacheConfig::LruCacheConfig(const yaml_config::YamlConfig& config)
       lifetime(config[kLifetime].As<std::chrono::milliseconds>(0)),
       background_update(config[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      background_update_percent(ParseBackgroundUpdatePercent(
+          config[kBackgroundUpdateFraction].As<double>(0.5))) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
 }
 
@@ -40,7 +55,9 @@ LruCacheConfig::LruCacheConfig(const formats::json::Value& value)
       lifetime(ParseMs(value[kLifetimeMs])),
       background_update(value[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      background_update_percent(ParseBackgroundUpdatePercent(
+          value[kBackgroundUpdateFraction].As<double>(0.5))) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
 }
 
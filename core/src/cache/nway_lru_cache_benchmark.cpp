@@ -0,0 +1,88 @@
+#include <userver/cache/nway_lru_cache.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Contention suite for the N-way LRU: args are (ways, concurrent tasks).
+// Hot-key Get is the worst case the sharding cannot spread - every access
+// serializes on one way mutex plus the LRU-touch - while uniform Get/Put
+// shows how far the way count takes us. This is the regression harness for
+// any future striped/epoch-based variant.
+
+constexpr std::size_t kWaySize = 1024;
+constexpr int kOpsPerTask = 1024;
+
+void nway_lru_hot_key_get(benchmark::State& state) {
+  const auto ways = static_cast<std::size_t>(state.range(0));
+  const auto tasks = static_cast<std::size_t>(state.range(1));
+
+  engine::RunStandalone(tasks, [&] {
+    cache::NWayLRU<int, int> cache{ways, kWaySize};
+    cache.Put(0, 42);
+
+    for ([[maybe_unused]] auto _ : state) {
+      std::vector<engine::TaskWithResult<void>> workers;
+      workers.reserve(tasks);
+      for (std::size_t i = 0; i < tasks; ++i) {
+        workers.push_back(engine::AsyncNoSpan([&cache] {
+          for (int op = 0; op < kOpsPerTask; ++op) {
+            benchmark::DoNotOptimize(cache.Get(0));
+          }
+        }));
+      }
+      for (auto& worker : workers) worker.Get();
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(tasks * kOpsPerTask));
+  });
+}
+BENCHMARK(nway_lru_hot_key_get)
+    ->Args({16, 2})
+    ->Args({16, 8})
+    ->Args({256, 8});
+
+void nway_lru_uniform_mixed(benchmark::State& state) {
+  const auto ways = static_cast<std::size_t>(state.range(0));
+  const auto tasks = static_cast<std::size_t>(state.range(1));
+
+  engine::RunStandalone(tasks, [&] {
+    cache::NWayLRU<int, int> cache{ways, kWaySize};
+
+    for ([[maybe_unused]] auto _ : state) {
+      std::vector<engine::TaskWithResult<void>> workers;
+      workers.reserve(tasks);
+      for (std::size_t i = 0; i < tasks; ++i) {
+        workers.push_back(engine::AsyncNoSpan([&cache, i] {
+          for (int op = 0; op < kOpsPerTask; ++op) {
+            const int key = static_cast<int>(i) * kOpsPerTask + op;
+            if (op % 8 == 0) {
+              cache.Put(key, op);
+            } else {
+              benchmark::DoNotOptimize(cache.Get(key));
+            }
+          }
+        }));
+      }
+      for (auto& worker : workers) worker.Get();
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(tasks * kOpsPerTask));
+  });
+}
+BENCHMARK(nway_lru_uniform_mixed)
+    ->Args({16, 2})
+    ->Args({16, 8})
+    ->Args({256, 8});
+
+}  // namespace
+
+USERVER_NAMESPACE_END
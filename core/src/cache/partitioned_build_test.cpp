@@ -0,0 +1,41 @@
+#include <userver/cache/partitioned_build.hpp>
+
+#include <stdexcept>
+#include <unordered_map>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST_MT(CachePartitionedBuild, ShardedMapAssembly, 4) {
+  constexpr std::size_t kKeys = 1000;
+  constexpr std::size_t kShards = 4;
+
+  auto shards = cache::BuildPartitioned(
+      kShards, "test-shard", [](std::size_t shard, std::size_t shard_count) {
+        std::unordered_map<int, int> result;
+        for (std::size_t key = shard; key < kKeys; key += shard_count) {
+          result[static_cast<int>(key)] = static_cast<int>(key * 2);
+        }
+        return result;
+      });
+  ASSERT_EQ(shards.size(), kShards);
+
+  const auto snapshot = cache::MergePartitioned(std::move(shards));
+  ASSERT_EQ(snapshot.size(), kKeys);
+  EXPECT_EQ(snapshot.at(17), 34);
+  EXPECT_EQ(snapshot.at(999), 1998);
+}
+
+UTEST(CachePartitionedBuild, ShardExceptionPropagates) {
+  UEXPECT_THROW(
+      cache::BuildPartitioned(2, "test-shard",
+                              [](std::size_t shard, std::size_t) -> int {
+                                if (shard == 1)
+                                  throw std::runtime_error{"shard failed"};
+                                return 0;
+                              }),
+      std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,132 @@
+#include <userver/cache/shm_key_value_store.hpp>
+
+#include <stdexcept>
+
+#include <boost/interprocess/allocators/allocator.hpp>
+#include <boost/interprocess/containers/map.hpp>
+#include <boost/interprocess/containers/string.hpp>
+#include <boost/interprocess/managed_shared_memory.hpp>
+#include <boost/interprocess/sync/interprocess_mutex.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace {
+
+namespace bip = boost::interprocess;
+
+using SegmentManager = bip::managed_shared_memory::segment_manager;
+using ShmCharAllocator = bip::allocator<char, SegmentManager>;
+using ShmString =
+    bip::basic_string<char, std::char_traits<char>, ShmCharAllocator>;
+
+// Transparent: lookups take std::string_view keys directly, so Get/Remove
+// never allocate a temporary key inside the (possibly full) segment.
+struct ShmStringLess final {
+  using is_transparent = void;
+
+  static std::string_view AsView(const ShmString& str) noexcept {
+    return {str.data(), str.size()};
+  }
+
+  bool operator()(const ShmString& lhs, const ShmString& rhs) const noexcept {
+    return AsView(lhs) < AsView(rhs);
+  }
+  bool operator()(const ShmString& lhs, std::string_view rhs) const noexcept {
+    return AsView(lhs) < rhs;
+  }
+  bool operator()(std::string_view lhs, const ShmString& rhs) const noexcept {
+    return lhs < AsView(rhs);
+  }
+};
+
+using ShmMapValue = std::pair<const ShmString, ShmString>;
+using ShmMapAllocator = bip::allocator<ShmMapValue, SegmentManager>;
+using ShmMap = bip::map<ShmString, ShmString, ShmStringLess, ShmMapAllocator>;
+
+constexpr const char* kMapName = "userver-shm-kv-map";
+constexpr const char* kMutexName = "userver-shm-kv-mutex";
+
+}  // namespace
+
+struct ShmKeyValueStore::Impl {
+  explicit Impl(const std::string& name, std::size_t segment_size)
+      : segment(bip::open_or_create, name.c_str(), segment_size),
+        mutex(segment.find_or_construct<bip::interprocess_mutex>(kMutexName)()),
+        map(segment.find_or_construct<ShmMap>(kMapName)(
+            ShmStringLess{},
+            ShmMapAllocator{segment.get_segment_manager()})) {}
+
+  ShmString MakeShmString(std::string_view str) {
+    return ShmString{str.data(), str.size(),
+                     ShmCharAllocator{segment.get_segment_manager()}};
+  }
+
+  bip::managed_shared_memory segment;
+  bip::interprocess_mutex* mutex;
+  ShmMap* map;
+};
+
+ShmKeyValueStore::ShmKeyValueStore(const std::string& name,
+                                   std::size_t segment_size) {
+  try {
+    impl_ = std::make_unique<Impl>(name, segment_size);
+  } catch (const bip::interprocess_exception& ex) {
+    throw std::runtime_error(fmt::format(
+        "Failed to open shared-memory segment '{}': {}", name, ex.what()));
+  }
+}
+
+ShmKeyValueStore::~ShmKeyValueStore() = default;
+
+std::optional<std::string> ShmKeyValueStore::Get(std::string_view key) const {
+  const bip::scoped_lock<bip::interprocess_mutex> lock(*impl_->mutex);
+  // transparent lookup: nothing is allocated in the segment
+  const auto it = impl_->map->find(key);
+  if (it == impl_->map->end()) return std::nullopt;
+  return std::string{it->second.data(), it->second.size()};
+}
+
+void ShmKeyValueStore::Put(std::string_view key, std::string_view value) {
+  try {
+    const bip::scoped_lock<bip::interprocess_mutex> lock(*impl_->mutex);
+    const auto it = impl_->map->find(key);
+    if (it != impl_->map->end()) {
+      it->second.assign(value.data(), value.size());
+    } else {
+      impl_->map->emplace(impl_->MakeShmString(key),
+                          impl_->MakeShmString(value));
+    }
+  } catch (const bip::bad_alloc&) {
+    throw std::runtime_error(
+        "ShmKeyValueStore: shared-memory segment is out of space");
+  }
+}
+
+void ShmKeyValueStore::Remove(std::string_view key) {
+  const bip::scoped_lock<bip::interprocess_mutex> lock(*impl_->mutex);
+  // transparent lookup: nothing is allocated in the segment
+  const auto it = impl_->map->find(key);
+  if (it != impl_->map->end()) impl_->map->erase(it);
+}
+
+std::size_t ShmKeyValueStore::GetSize() const {
+  const bip::scoped_lock<bip::interprocess_mutex> lock(*impl_->mutex);
+  return impl_->map->size();
+}
+
+std::size_t ShmKeyValueStore::GetFreeMemory() const {
+  return impl_->segment.get_free_memory();
+}
+
+void ShmKeyValueStore::Reset(const std::string& name) {
+  bip::shared_memory_object::remove(name.c_str());
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,79 @@
+#include <userver/cache/shm_key_value_store.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/utest/assert_macros.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class ShmKeyValueStoreTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    name_ = "userver-test-shm-" + std::to_string(utils::Rand());
+    cache::ShmKeyValueStore::Reset(name_);
+  }
+
+  void TearDown() override { cache::ShmKeyValueStore::Reset(name_); }
+
+  std::string name_;
+  static constexpr std::size_t kSegmentSize = 1 << 20;
+};
+
+}  // namespace
+
+TEST_F(ShmKeyValueStoreTest, PutGetRemove) {
+  cache::ShmKeyValueStore store{name_, kSegmentSize};
+
+  EXPECT_EQ(store.Get("key"), std::nullopt);
+  store.Put("key", "value");
+  EXPECT_EQ(store.Get("key"), "value");
+  EXPECT_EQ(store.GetSize(), 1);
+
+  store.Put("key", "replaced");
+  EXPECT_EQ(store.Get("key"), "replaced");
+  EXPECT_EQ(store.GetSize(), 1);
+
+  store.Remove("key");
+  EXPECT_EQ(store.Get("key"), std::nullopt);
+  EXPECT_EQ(store.GetSize(), 0);
+}
+
+TEST_F(ShmKeyValueStoreTest, SurvivesReopen) {
+  {
+    cache::ShmKeyValueStore store{name_, kSegmentSize};
+    store.Put("warm", "data");
+  }
+
+  // a new instance (as after a binary restart) finds the previous contents
+  cache::ShmKeyValueStore reopened{name_, kSegmentSize};
+  EXPECT_EQ(reopened.Get("warm"), "data");
+}
+
+TEST_F(ShmKeyValueStoreTest, ResetStartsCold) {
+  {
+    cache::ShmKeyValueStore store{name_, kSegmentSize};
+    store.Put("warm", "data");
+  }
+
+  cache::ShmKeyValueStore::Reset(name_);
+  cache::ShmKeyValueStore fresh{name_, kSegmentSize};
+  EXPECT_EQ(fresh.Get("warm"), std::nullopt);
+}
+
+TEST_F(ShmKeyValueStoreTest, OutOfSpaceThrows) {
+  cache::ShmKeyValueStore store{name_, 64 * 1024};
+
+  const std::string big_value(16 * 1024, 'x');
+  UEXPECT_THROW(
+      [&] {
+        for (int i = 0; i < 100; ++i) {
+          store.Put("key" + std::to_string(i), big_value);
+        }
+      }(),
+      std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -159,6 +159,10 @@ class Resolver::Impl {
     AddrVector addrs;
     std::chrono::steady_clock::time_point expiration;
     bool is_failure{false};
+    // original reply TTL, drives the refresh-ahead threshold
+    std::chrono::milliseconds ttl{};
+    // consecutive failures, drives the negative-cache backoff
+    unsigned failure_count{0};
   };
 
   template <typename Mutex>
@@ -241,7 +245,13 @@ Resolver::Impl::NetCacheResult Resolver::Impl::QueryNetCache(
     ++source_counters_.cached_stale;
   }
 
-  if (cached->expiration - now >= net_cache_update_margin_) {
+  // Refresh-ahead: start the background re-resolve once ~80% of the TTL has
+  // elapsed (but no later than the network-timeout margin before expiry), so
+  // steady traffic never observes an expired entry.
+  const auto refresh_margin = std::max(
+      net_cache_update_margin_,
+      std::chrono::duration_cast<std::chrono::milliseconds>(cached->ttl / 5));
+  if (cached->expiration - now >= refresh_margin) {
     result.status = NetCacheResult::Status::kHitReply;
   } else {
     result.status = NetCacheResult::Status::kHitReplyWithUpdate;
@@ -335,11 +345,24 @@ void Resolver::Impl::FinishNetUpdate(
   } catch (const ResolverException& ex) {
     LOG_LIMITED_ERROR() << "Resolving of '" << name << "' failed: " << ex;
     if (failure_mode == FailureMode::kCache) {
-      LOG_TRACE() << "Caching failure for '" << name << '\'';
-      net_cache_.Put(name, NetCacheEntry{{},
-                                         utils::datetime::MockSteadyNow() +
-                                             net_cache_failure_ttl_,
-                                         true});
+      // Exponential backoff of the negative cache: repeated failures for
+      // the same name are retried progressively less often.
+      unsigned failure_count = 1;
+      const auto previous = net_cache_.Get(name);
+      if (previous && previous->is_failure) {
+        failure_count = std::min(previous->failure_count + 1, 6u);
+      }
+      const auto backoff_ttl =
+          net_cache_failure_ttl_ * (1u << (failure_count - 1));
+      LOG_TRACE() << "Caching failure for '" << name << "' for "
+                  << backoff_ttl.count() << "ms";
+      net_cache_.Put(name,
+                     NetCacheEntry{{},
+                                   utils::datetime::MockSteadyNow() +
+                                       backoff_ttl,
+                                   true,
+                                   backoff_ttl,
+                                   failure_count});
     }
     ++source_counters_.network_failure;
     throw;
@@ -353,8 +376,12 @@ void Resolver::Impl::FinishNetUpdate(
   if (effective_ttl.count() > 0) {
     LOG_TRACE() << "Updating cache for '" << name << '\'';
     net_cache_.Put(
-        name, NetCacheEntry{std::move(response.addrs),
-                            utils::datetime::MockSteadyNow() + effective_ttl});
+        name,
+        NetCacheEntry{std::move(response.addrs),
+                      utils::datetime::MockSteadyNow() + effective_ttl, false,
+                      std::chrono::duration_cast<std::chrono::milliseconds>(
+                          effective_ttl),
+                      0});
   } else {
     LOG_TRACE() << "Skipping cache update for '" << name << '\'';
   }
@@ -15,6 +15,8 @@
 #include <userver/clients/http/client.hpp>
 #include <userver/clients/http/config.hpp>
 #include <userver/clients/http/plugin_component.hpp>
+#include <userver/clients/http/response_future.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/tracing/manager_component.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -141,6 +143,29 @@ HttpClient::HttpClient(const ComponentConfig& component_config,
           .GetEventSource()
           .AddListener(this, kName, &HttpClient::OnConfigUpdate);
 
+  const auto prewarm_config = component_config["prewarm"];
+  if (!prewarm_config.IsMissing()) {
+    prewarm_destinations_ =
+        prewarm_config["destinations"].As<std::vector<std::string>>({});
+    prewarm_connections_ =
+        prewarm_config["connections-per-destination"].As<std::size_t>(1);
+    const auto keeper_interval =
+        prewarm_config["keeper-interval"].As<std::chrono::seconds>(
+            std::chrono::seconds{15});
+
+    if (!prewarm_destinations_.empty()) {
+      // kChaotic jitters the period, so the keep-alive connections of a
+      // fleet do not expire (and reconnect) in synchronized waves.
+      prewarm_task_.Start(
+          "http-client-prewarm",
+          utils::PeriodicTask::Settings{
+              keeper_interval,
+              {utils::PeriodicTask::Flags::kNow,
+               utils::PeriodicTask::Flags::kChaotic}},
+          [this] { PrewarmConnections(); });
+    }
+  }
+
   const auto thread_name_prefix =
       component_config["thread-name-prefix"].As<std::string>("");
   auto stats_name =
@@ -168,10 +193,43 @@ std::vector<utils::NotNull<clients::http::Plugin*>> HttpClient::FindPlugins(
 }
 
 HttpClient::~HttpClient() {
+  prewarm_task_.Stop();
   subscriber_scope_.Unsubscribe();
   statistics_holder_.Unregister();
 }
 
+void HttpClient::PrewarmConnections() {
+  constexpr std::chrono::seconds kPrewarmTimeout{2};
+
+  std::vector<clients::http::ResponseFuture> futures;
+  futures.reserve(prewarm_destinations_.size() * prewarm_connections_);
+  for (const auto& url : prewarm_destinations_) {
+    // Parallel in-flight requests force the pool to hold that many
+    // connections to the destination.
+    for (std::size_t i = 0; i < prewarm_connections_; ++i) {
+      try {
+        futures.push_back(http_client_.CreateRequest()
+                              .head(url)
+                              .timeout(kPrewarmTimeout)
+                              .retry(1)
+                              .async_perform());
+      } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to start a pre-warm request to '" << url
+                      << "': " << ex;
+      }
+    }
+  }
+
+  for (auto& future : futures) {
+    try {
+      [[maybe_unused]] auto response = future.Get();
+    } catch (const std::exception& ex) {
+      // the connection attempt itself is what matters
+      LOG_DEBUG() << "Pre-warm request failed: " << ex;
+    }
+  }
+}
+
 clients::http::Client& HttpClient::GetHttpClient() { return http_client_; }
 
 void HttpClient::OnConfigUpdate(const dynamic_config::Snapshot& config) {
@@ -256,6 +314,28 @@ properties:
         items:
             type: string
             description: plugin name
+    prewarm:
+        type: object
+        description: connection pool pre-warming options
+        additionalProperties: false
+        properties:
+            destinations:
+                type: array
+                description: URLs to pre-establish connections to at startup
+                items:
+                    type: string
+                    description: destination URL
+            connections-per-destination:
+                type: integer
+                description: connections to keep established per destination
+                defaultDescription: 1
+            keeper-interval:
+                type: string
+                description: |
+                    period of the background keeper that re-warms the pool;
+                    jittered, so fleet-wide keep-alive connections do not
+                    expire in synchronized waves
+                defaultDescription: 15s
     cancellation-policy:
         type: string
         description: Cancellation policy for new requests
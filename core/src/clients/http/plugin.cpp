@@ -18,6 +18,14 @@ void PluginRequest::SetTimeout(std::chrono::milliseconds ms) {
   state_.SetEasyTimeout(ms);
 }
 
+const std::string& PluginRequest::GetOriginalUrl() const {
+  return state_.easy().get_original_url();
+}
+
+bool PluginRequest::IsFirstAttempt() const {
+  return state_.current_retry() <= 1;
+}
+
 Plugin::Plugin(std::string name) : name_(std::move(name)) {}
 
 const std::string& Plugin::GetName() const { return name_; }
@@ -0,0 +1,58 @@
+#include <userver/clients/http/plugins/adaptive_concurrency/component.hpp>
+
+#include <clients/http/plugins/adaptive_concurrency/plugin.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::adaptive_concurrency {
+
+namespace {
+
+Plugin::Settings ParseSettings(const components::ComponentConfig& config) {
+  Plugin::Settings settings;
+  settings.min_limit = config["min-limit"].As<std::size_t>(settings.min_limit);
+  settings.max_limit = config["max-limit"].As<std::size_t>(settings.max_limit);
+  settings.initial_limit =
+      config["initial-limit"].As<std::size_t>(settings.initial_limit);
+  return settings;
+}
+
+}  // namespace
+
+Component::Component(const components::ComponentConfig& config,
+                     const components::ComponentContext& context)
+    : ComponentBase(config, context),
+      plugin_(std::make_unique<adaptive_concurrency::Plugin>(
+          ParseSettings(config))) {}
+
+Component::~Component() = default;
+
+http::Plugin& Component::GetPlugin() { return *plugin_; }
+
+yaml_config::Schema Component::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
+type: object
+description: Adaptive per-destination concurrency limiter for the HTTP client.
+additionalProperties: false
+properties:
+    min-limit:
+        type: integer
+        description: lower bound of the per-destination limit
+        defaultDescription: 4
+    max-limit:
+        type: integer
+        description: upper bound of the per-destination limit
+        defaultDescription: 1024
+    initial-limit:
+        type: integer
+        description: limit of a freshly seen destination
+        defaultDescription: 64
+)");
+}
+
+}  // namespace clients::http::plugins::adaptive_concurrency
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,146 @@
+#include <clients/http/plugins/adaptive_concurrency/plugin.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <string_view>
+
+#include <userver/clients/http/response.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::adaptive_concurrency {
+
+namespace {
+
+constexpr std::string_view kPluginName = "adaptive-concurrency";
+
+// EMA smoothing: the short window reacts to brownouts, the long one
+// remembers the healthy baseline.
+constexpr double kShortSmoothing = 0.2;
+constexpr double kLongSmoothing = 0.02;
+
+// Recompute the limit once per this many samples.
+constexpr std::uint32_t kLimitUpdatePeriod = 32;
+
+// Gradient clamp: shrink fast, grow slowly.
+constexpr double kMinGradient = 0.5;
+constexpr double kMaxGradient = 1.05;
+
+// scheme://host:port slice of the URL; a view into the caller's string
+std::string_view ExtractDestination(std::string_view url) {
+  const auto scheme_pos = url.find("://");
+  const auto host_begin =
+      scheme_pos == std::string_view::npos ? 0 : scheme_pos + 3;
+  const auto path_pos = url.find('/', host_begin);
+  return url.substr(0, path_pos);
+}
+
+void UpdateEma(std::atomic<double>& ema, double sample,
+               double smoothing) noexcept {
+  const auto old_value = ema.load(std::memory_order_relaxed);
+  const auto new_value =
+      old_value == 0.0 ? sample : old_value + smoothing * (sample - old_value);
+  ema.store(new_value, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+Plugin::Plugin(Settings settings)
+    : http::Plugin(std::string{kPluginName}), settings_(settings) {
+  UASSERT(settings_.min_limit > 0);
+  UASSERT(settings_.min_limit <= settings_.initial_limit);
+  UASSERT(settings_.initial_limit <= settings_.max_limit);
+}
+
+std::shared_ptr<Plugin::DestinationState> Plugin::GetOrCreateState(
+    std::string_view destination) {
+  const std::lock_guard lock(states_mutex_);
+  if (const auto* const existing =
+          utils::impl::FindTransparentOrNullptr(states_, destination)) {
+    return *existing;
+  }
+  return states_
+      .emplace(std::string{destination},
+               std::make_shared<DestinationState>(settings_.initial_limit))
+      .first->second;
+}
+
+std::shared_ptr<Plugin::DestinationState> Plugin::FindState(
+    std::string_view destination) {
+  const std::lock_guard lock(states_mutex_);
+  const auto* const existing =
+      utils::impl::FindTransparentOrNullptr(states_, destination);
+  return existing ? *existing : nullptr;
+}
+
+void Plugin::HookPerformRequest(PluginRequest& request) {
+  // Retries of an admitted request stay admitted: in_flight is balanced by
+  // the single HookOnCompleted of the overall request.
+  if (!request.IsFirstAttempt()) return;
+
+  const auto destination = ExtractDestination(request.GetOriginalUrl());
+  const auto state = GetOrCreateState(destination);
+
+  // in_flight is balanced by HookOnCompleted, which runs for every request
+  // that was actually performed (response or timeout).
+  const auto in_flight =
+      state->in_flight.fetch_add(1, std::memory_order_relaxed) + 1;
+  if (in_flight > state->limit.load(std::memory_order_relaxed)) {
+    state->in_flight.fetch_sub(1, std::memory_order_relaxed);
+    throw ConcurrencyLimitExceeded(destination);
+  }
+}
+
+void Plugin::HookCreateSpan(PluginRequest&) {}
+
+void Plugin::HookOnCompleted(PluginRequest& request, Response& response) {
+  // Runs in the ev thread: a transparent lookup (no allocations) under a
+  // briefly-held mutex, then atomics. The state always exists - it was
+  // created by HookPerformRequest in coroutine context.
+  const auto state = FindState(ExtractDestination(request.GetOriginalUrl()));
+  if (!state) return;
+  state->in_flight.fetch_sub(1, std::memory_order_relaxed);
+
+  const auto sample_ms =
+      std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+          response.GetStats().time_to_process)
+          .count();
+  if (sample_ms <= 0.0) return;
+
+  UpdateEma(state->short_rtt_ms, sample_ms, kShortSmoothing);
+  UpdateEma(state->long_rtt_ms, sample_ms, kLongSmoothing);
+
+  if (state->sample_count.fetch_add(1, std::memory_order_relaxed) %
+          kLimitUpdatePeriod !=
+      kLimitUpdatePeriod - 1) {
+    return;
+  }
+
+  const auto short_rtt = state->short_rtt_ms.load(std::memory_order_relaxed);
+  const auto long_rtt = state->long_rtt_ms.load(std::memory_order_relaxed);
+  if (short_rtt <= 0.0 || long_rtt <= 0.0) return;
+
+  const auto gradient =
+      std::clamp(long_rtt / short_rtt, kMinGradient, kMaxGradient);
+  const auto old_limit =
+      static_cast<double>(state->limit.load(std::memory_order_relaxed));
+  // The additive headroom lets the limit regrow after a brownout, where the
+  // gradient alone would keep it pinned.
+  constexpr std::size_t kGrowthHeadroom = 2;
+  const auto new_limit = std::clamp(
+      static_cast<std::size_t>(old_limit * gradient) + kGrowthHeadroom,
+      settings_.min_limit, settings_.max_limit);
+  state->limit.store(new_limit, std::memory_order_relaxed);
+}
+
+std::size_t Plugin::GetCurrentLimit(const std::string& destination) const {
+  const std::lock_guard lock(states_mutex_);
+  const auto it = states_.find(destination);
+  return it == states_.end() ? settings_.initial_limit
+                             : it->second->limit.load();
+}
+
+}  // namespace clients::http::plugins::adaptive_concurrency
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <userver/clients/http/plugin.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::adaptive_concurrency {
+
+/// Thrown by the limiter on fast-fail rejection, before any IO happens.
+class ConcurrencyLimitExceeded final : public std::runtime_error {
+ public:
+  explicit ConcurrencyLimitExceeded(const std::string& destination)
+      : std::runtime_error("Adaptive concurrency limit exceeded for " +
+                           destination) {}
+};
+
+// Gradient-style adaptive concurrency limiter applied per destination
+// (scheme://host:port). The limit tracks the ratio of the long-term to the
+// short-term latency EMA: when a downstream browns out, its short-term
+// latency grows, the gradient shrinks the limit and the excess requests
+// fast-fail instead of piling up in curl's multi handle and starving
+// unrelated destinations.
+class Plugin final : public http::Plugin {
+ public:
+  struct Settings final {
+    std::size_t min_limit{4};
+    std::size_t max_limit{1024};
+    std::size_t initial_limit{64};
+  };
+
+  explicit Plugin(Settings settings);
+
+  void HookPerformRequest(PluginRequest& request) override;
+  void HookCreateSpan(PluginRequest& request) override;
+  void HookOnCompleted(PluginRequest& request, Response& response) override;
+
+  /// Current limit of the destination, mostly for metrics and tests.
+  std::size_t GetCurrentLimit(const std::string& destination) const;
+
+ private:
+  struct DestinationState final {
+    explicit DestinationState(std::size_t initial_limit)
+        : limit(initial_limit) {}
+
+    std::atomic<std::size_t> in_flight{0};
+    std::atomic<std::size_t> limit;
+    // relaxed-updated EMAs; a lost update only delays convergence
+    std::atomic<double> short_rtt_ms{0.0};
+    std::atomic<double> long_rtt_ms{0.0};
+    std::atomic<std::uint32_t> sample_count{0};
+  };
+
+  // Coroutine-context path, creates the state on first sight of the
+  // destination.
+  std::shared_ptr<DestinationState> GetOrCreateState(
+      std::string_view destination);
+
+  // Lookup-only (transparent, no allocations): the ev-thread completion
+  // path, where the state always exists already.
+  std::shared_ptr<DestinationState> FindState(std::string_view destination);
+
+  const Settings settings_;
+  mutable std::mutex states_mutex_;
+  utils::impl::TransparentMap<std::string, std::shared_ptr<DestinationState>>
+      states_;
+};
+
+}  // namespace clients::http::plugins::adaptive_concurrency
+
+USERVER_NAMESPACE_END
@@ -10,6 +10,7 @@
 #include <userver/clients/http/connect_to.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
+#include <userver/clients/http/request_body_stream.hpp>
 #include <userver/clients/http/response_future.hpp>
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -376,6 +377,14 @@ Request Request::data(std::string data) && {
   return std::move(this->data(std::move(data)));
 }
 
+Request& Request::body_stream(const RequestBodyStream& body) & {
+  pimpl_->SetStreamedBody(body.GetState());
+  return *this;
+}
+Request Request::body_stream(const RequestBodyStream& body) && {
+  return std::move(this->body_stream(body));
+}
+
 Request& Request::form(Form&& form) & {
   pimpl_->easy().set_http_post(std::move(form).GetNative());
   pimpl_->easy().add_header(kHeaderExpect, "",
@@ -0,0 +1,71 @@
+#include <userver/clients/http/request_body_stream.hpp>
+
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+std::shared_ptr<concurrent::StringStreamQueue> MakeQueue(
+    std::size_t max_queued_bytes) {
+  auto queue = concurrent::StringStreamQueue::Create();
+  queue->SetSoftMaxSize(max_queued_bytes);
+  return queue;
+}
+
+}  // namespace
+
+RequestBodyStream::State::State(std::size_t max_queued_bytes)
+    : State(MakeQueue(max_queued_bytes)) {}
+
+RequestBodyStream::State::State(
+    std::shared_ptr<concurrent::StringStreamQueue> queue)
+    : producer_(queue->GetProducer()), consumer_(queue->GetConsumer()) {}
+
+RequestBodyStream::RequestBodyStream(std::size_t max_queued_bytes)
+    : state_(std::make_shared<State>(max_queued_bytes)) {}
+
+bool RequestBodyStream::PushChunk(std::string chunk) {
+  return state_->Push(std::move(chunk));
+}
+
+void RequestBodyStream::Close() { state_->Close(); }
+
+bool RequestBodyStream::State::Push(std::string&& chunk) {
+  const bool pushed = producer_.Push(std::move(chunk), {});
+  if (pushed) NotifyResume();
+  return pushed;
+}
+
+void RequestBodyStream::State::Close() {
+  closed_.store(true);
+  NotifyResume();
+}
+
+bool RequestBodyStream::State::PopChunkNoblock(std::string& chunk) {
+  return consumer_.PopNoblock(chunk);
+}
+
+bool RequestBodyStream::State::IsClosed() const noexcept {
+  return closed_.load();
+}
+
+void RequestBodyStream::State::SetResumeHook(std::function<void()> hook) {
+  const std::lock_guard lock(resume_mutex_);
+  resume_ = std::move(hook);
+}
+
+void RequestBodyStream::State::NotifyResume() {
+  std::function<void()> hook;
+  {
+    const std::lock_guard lock(resume_mutex_);
+    hook = resume_;
+  }
+  if (hook) hook();
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,66 @@
+#include <userver/clients/http/request_body_stream.hpp>
+
+#include <atomic>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(RequestBodyStream, PushPopClose) {
+  clients::http::RequestBodyStream body;
+  const auto state = body.GetState();
+
+  std::atomic<int> resumes{0};
+  state->SetResumeHook([&resumes] { ++resumes; });
+
+  EXPECT_TRUE(body.PushChunk("first"));
+  EXPECT_TRUE(body.PushChunk("second"));
+  EXPECT_EQ(resumes.load(), 2);
+
+  std::string chunk;
+  ASSERT_TRUE(state->PopChunkNoblock(chunk));
+  EXPECT_EQ(chunk, "first");
+  ASSERT_TRUE(state->PopChunkNoblock(chunk));
+  EXPECT_EQ(chunk, "second");
+  EXPECT_FALSE(state->PopChunkNoblock(chunk));
+  EXPECT_FALSE(state->IsClosed());
+
+  body.Close();
+  EXPECT_TRUE(state->IsClosed());
+  EXPECT_EQ(resumes.load(), 3);
+  EXPECT_FALSE(state->PopChunkNoblock(chunk));
+}
+
+UTEST(RequestBodyStream, ChunkQueuedBeforeCloseIsNotLost) {
+  clients::http::RequestBodyStream body;
+  const auto state = body.GetState();
+
+  EXPECT_TRUE(body.PushChunk("last"));
+  body.Close();
+
+  // the consumer must drain queued chunks even after Close
+  std::string chunk;
+  EXPECT_TRUE(state->IsClosed());
+  ASSERT_TRUE(state->PopChunkNoblock(chunk));
+  EXPECT_EQ(chunk, "last");
+  EXPECT_FALSE(state->PopChunkNoblock(chunk));
+}
+
+UTEST_MT(RequestBodyStream, BackpressureAndRelease, 2) {
+  clients::http::RequestBodyStream body{/*max_queued_bytes=*/8};
+  const auto state = body.GetState();
+
+  EXPECT_TRUE(body.PushChunk("01234567"));  // fills the byte bound
+
+  auto producer = engine::AsyncNoSpan(
+      [&body] { return body.PushChunk("blocked-until-pop"); });
+  producer.WaitFor(std::chrono::milliseconds{50});
+  EXPECT_FALSE(producer.IsFinished());  // backpressure holds
+
+  std::string chunk;
+  ASSERT_TRUE(state->PopChunkNoblock(chunk));
+  EXPECT_TRUE(producer.Get());  // space freed, push completes
+}
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <map>
 #include <string_view>
 
@@ -336,6 +337,65 @@ void RequestState::retry(short retries, bool on_fails) {
   retry_.on_fails = on_fails;
 }
 
+namespace {
+
+// Pulls queued body chunks into curl's read callback on the ev thread;
+// kWouldBlock pauses the transfer and RequestBodyStream's resume hook
+// unpauses it when the producer pushes or closes.
+class StreamedBodySource final : public curl::easy::streaming_source {
+ public:
+  explicit StreamedBodySource(
+      std::shared_ptr<RequestBodyStream::State> state)
+      : state_(std::move(state)) {}
+
+  ReadStatus Read(char* buffer, std::size_t capacity,
+                  std::size_t& bytes_written) override {
+    bytes_written = 0;
+    while (true) {
+      if (pending_pos_ < pending_.size()) {
+        const auto chunk_size =
+            std::min(capacity, pending_.size() - pending_pos_);
+        std::memcpy(buffer, pending_.data() + pending_pos_, chunk_size);
+        pending_pos_ += chunk_size;
+        bytes_written = chunk_size;
+        return ReadStatus::kProduced;
+      }
+
+      std::string chunk;
+      if (state_->PopChunkNoblock(chunk)) {
+        pending_ = std::move(chunk);
+        pending_pos_ = 0;
+        continue;  // also skips empty chunks
+      }
+      if (state_->IsClosed()) {
+        // the producer may have pushed the last chunk just before Close
+        if (state_->PopChunkNoblock(chunk)) {
+          pending_ = std::move(chunk);
+          pending_pos_ = 0;
+          continue;
+        }
+        return ReadStatus::kEof;
+      }
+      return ReadStatus::kWouldBlock;
+    }
+  }
+
+ private:
+  std::shared_ptr<RequestBodyStream::State> state_;
+  std::string pending_;
+  std::size_t pending_pos_{0};
+};
+
+}  // namespace
+
+void RequestState::SetStreamedBody(
+    std::shared_ptr<RequestBodyStream::State> state) {
+  UASSERT(state);
+  streamed_body_state_ = std::move(state);
+  // a streamed body cannot be rewound for another attempt
+  retry(1, false);
+}
+
 void RequestState::unix_socket_path(const std::string& path) {
   easy().set_unix_socket_path(path);
 }
@@ -496,6 +556,10 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder,
       LOG_DEBUG() << "cURL error details: " << holder->errorbuffer_.data();
     }
 
+    // Plugins must observe the completion of errored requests too (the
+    // response is valid, but carries no status code and no headers).
+    holder->plugin_pipeline_.HookOnCompleted(*holder, *holder->response());
+
     holder->span_storage_.reset();
 
     const utils::Overloaded visitor{
@@ -721,6 +785,18 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
   response_->sink_string().clear();
   response_->body().clear();
 
+  if (streamed_body_state_) {
+    easy().set_streaming_source(
+        std::make_shared<StreamedBodySource>(streamed_body_state_));
+    easy().set_upload(true);
+    // producer pushes must be able to kick a paused transfer; the easy may
+    // outlive or predecease the producer, hence the weak_ptr
+    streamed_body_state_->SetResumeHook(
+        [weak_easy = std::weak_ptr<curl::easy>(easy().shared_from_this())] {
+          if (auto easy = weak_easy.lock()) easy->resume_upload();
+        });
+  }
+
   UpdateTimeoutHeader();
 
   plugin_pipeline_.HookPerformRequest(*this);
@@ -733,15 +809,9 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
         easy().async_perform(std::move(handler));
       } catch (const clients::dns::ResolverException& ex) {
         // TODO: should retry - TAXICOMMON-4932
-        auto* buffered_data = std::get_if<FullBufferedData>(&data_);
-        if (buffered_data) {
-          buffered_data->promise_.set_exception(std::current_exception());
-        }
+        FailWithoutPerform(std::current_exception());
       } catch (const BaseException& ex) {
-        auto* buffered_data = std::get_if<FullBufferedData>(&data_);
-        if (buffered_data) {
-          buffered_data->promise_.set_exception(std::current_exception());
-        }
+        FailWithoutPerform(std::current_exception());
       }
     }).Detach();
   } else {
@@ -749,6 +819,18 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
   }
 }
 
+void RequestState::FailWithoutPerform(std::exception_ptr exception) {
+  // on_completed never runs for a request that was not performed, so the
+  // plugin completion hooks (e.g. the concurrency limiter's in_flight
+  // release) must fire here or their per-request accounting leaks
+  plugin_pipeline_.HookOnCompleted(*this, *response());
+
+  auto* buffered_data = std::get_if<FullBufferedData>(&data_);
+  if (buffered_data) {
+    buffered_data->promise_.set_exception(std::move(exception));
+  }
+}
+
 void RequestState::SetEasyTimeout(std::chrono::milliseconds timeout) {
   UASSERT_MSG(
       timeout >= std::chrono::seconds{0},
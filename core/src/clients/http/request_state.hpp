@@ -12,6 +12,7 @@
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
 #include <userver/clients/http/plugin.hpp>
+#include <userver/clients/http/request_body_stream.hpp>
 #include <userver/clients/http/request_tracing_editor.hpp>
 #include <userver/clients/http/response_future.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -81,6 +82,8 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   void set_timeout(long timeout_ms);
   /// set number of retries
   void retry(short retries, bool on_fails);
+  /// set a producer-driven chunked request body; disables retries
+  void SetStreamedBody(std::shared_ptr<RequestBodyStream::State> state);
   /// set unix socket as transport instead of TCP
   void unix_socket_path(const std::string& path);
   /// set connect_to option
@@ -98,6 +101,9 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   /// get retries count
   short retries() const { return retry_.retries; }
 
+  /// get current retry, starting from 1
+  short current_retry() const { return retry_.current; }
+
   engine::Deadline GetDeadline() const noexcept;
   /// true iff *we detected* that the deadline has expired
   bool IsDeadlineExpired() const noexcept;
@@ -157,6 +163,11 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   /// run curl async_request, called once per attempt
   void perform_request(curl::easy::handler_type handler);
 
+  // Terminates a request that failed before it was ever performed (e.g. DNS
+  // resolution failure): runs the plugin completion hooks that on_completed
+  // would have run, then delivers the exception.
+  void FailWithoutPerform(std::exception_ptr exception);
+
   void UpdateTimeoutFromDeadline(std::chrono::milliseconds backoff);
   [[nodiscard]] bool UpdateTimeoutFromDeadlineAndCheck(
       std::chrono::milliseconds backoff = {});
@@ -252,6 +263,9 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   };
 
   std::variant<FullBufferedData, StreamData> data_;
+
+  // producer-driven chunked request body, see RequestBodyStream
+  std::shared_ptr<RequestBodyStream::State> streamed_body_state_;
 };
 
 }  // namespace clients::http
@@ -103,6 +103,13 @@ properties:
                 type: integer
                 description: size of a single coroutine, bytes
                 defaultDescription: 256 * 1024
+            reclaim_stacks:
+                type: boolean
+                description: |
+                    release the cold tail of pooled coroutine stacks back
+                    to the kernel between tasks (madvise); keeps RSS close
+                    to the actual stack high-water mark
+                defaultDescription: false
     event_thread_pool:
         type: object
         description: event thread pool options
@@ -166,6 +173,28 @@ properties:
                         tunes the number of spin-wait iterations in case of
                         an empty task queue before threads go to sleep
                     defaultDescription: 10000
+                adaptive-spinning:
+                    type: boolean
+                    description: |
+                        makes spinning-iterations an upper bound of an
+                        adaptive spin budget that grows on bursty task
+                        arrivals and decays to zero when the queue is idle
+                    defaultDescription: false
+                numa-node:
+                    type: integer
+                    description: |
+                        NUMA node to pin the worker threads to; coroutine
+                        stacks are kept node-local. -1 disables pinning
+                    defaultDescription: -1
+                cpu-affinity:
+                    type: array
+                    description: |
+                        explicit CPU ids to pin the worker threads to;
+                        takes precedence over numa-node
+                    defaultDescription: '[]'
+                    items:
+                        type: integer
+                        description: CPU id
                 task-trace:
                     type: object
                     description: .
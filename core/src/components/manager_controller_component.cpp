@@ -49,6 +49,13 @@ void DumpMetric(utils::statistics::Writer& writer,
   }
 
   writer["worker-threads"] = task_processor.GetWorkerCount();
+
+  if (auto task_queue = writer["task-queue"]) {
+    const auto wait_times = counter.GetTaskQueueWaitTimes();
+    task_queue["wait-time-us"] = wait_times.GetView();
+    const auto depths = counter.GetTaskQueueDepths();
+    task_queue["depth"] = depths.GetView();
+  }
 }
 
 }  // namespace engine
@@ -103,6 +110,12 @@ void ManagerControllerComponent::WriteStatistics(
     writer["ev-threads"]["cpu-load-percent"].ValueWithLabels(
         thread->GetCurrentLoadPercent(),
         {{"ev_thread_name", thread->GetName()}});
+    // payloads-per-wakeup == drained-total / drain-runs-total
+    writer["ev-threads"]["payloads-drained-total"].ValueWithLabels(
+        thread->GetDrainedPayloadsTotal(),
+        {{"ev_thread_name", thread->GetName()}});
+    writer["ev-threads"]["payload-drain-runs-total"].ValueWithLabels(
+        thread->GetDrainRunsTotal(), {{"ev_thread_name", thread->GetName()}});
   }
 
   // coroutines
@@ -112,6 +125,12 @@ void ManagerControllerComponent::WriteStatistics(
           components_manager_.GetTaskProcessorPools()->GetCoroPool().GetStats();
       coro_stats["active"] = stats.active_coroutines;
       coro_stats["total"] = stats.total_coroutines;
+      if (auto stack_stats = coro_stats["stack-bytes"]) {
+        stack_stats["reserved"] = stats.reserved_stack_bytes;
+        stack_stats["committed-estimate"] =
+            stats.committed_stack_bytes_estimate;
+        stack_stats["reclaimed-total"] = stats.reclaimed_stack_bytes_total;
+      }
     }
   }
 
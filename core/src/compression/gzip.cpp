@@ -38,6 +38,24 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
   return decompressed;
 }
 
+std::string Compress(std::string_view data, int level) {
+  namespace bio = boost::iostreams;
+
+  std::string compressed;
+  try {
+    bio::filtering_ostream stream;
+    stream.push(bio::gzip_compressor(bio::gzip_params(level)));
+    stream.push(bio::back_inserter(compressed));
+    stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+    // finalizes the gzip stream
+    bio::close(stream);
+  } catch (const std::exception& ex) {
+    throw CompressionError(std::string{"failed to gzip data: "} + ex.what());
+  }
+
+  return compressed;
+}
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
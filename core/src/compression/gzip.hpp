@@ -12,6 +12,10 @@ namespace compression::gzip {
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string, level is the zlib 1..9 compression level.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level);
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
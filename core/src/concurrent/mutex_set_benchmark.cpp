@@ -186,6 +186,103 @@ BENCHMARK_TEMPLATE(mutex_set_8ways_lock_unlock_contention, std::string)
     ->RangeMultiplier(2)
     ->Range(1, 8);
 
+struct IdentityHash {
+  std::size_t operator()(std::size_t value) const noexcept { return value; }
+};
+
+// Distinct keys that hash into the same way share that way's MutexDatum, so
+// every lock/unlock serializes on its mutex and wakes its condition variable.
+// Measures the cost of a way collision against the spread case below.
+// Args: {ways, tasks}.
+void mutex_set_way_collision_contention(benchmark::State& state) {
+  engine::RunStandalone(state.range(1), [&] {
+    const std::size_t ways = state.range(0);
+    concurrent::MutexSet<std::size_t, IdentityHash> ms(ways);
+
+    // keys are distinct, but with the identity hash `thread_id * ways` always
+    // lands in way 0
+    const auto do_work = [&](std::size_t thread_id) {
+      auto mutex = ms.GetMutexForKey(thread_id * ways);
+      std::unique_lock lock(mutex);
+      benchmark::DoNotOptimize(lock);
+    };
+
+    const std::size_t concurrent_jobs = state.range(1);
+    std::atomic<bool> keep_running{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(concurrent_jobs);
+
+    for (std::size_t thread_id = 1; thread_id < concurrent_jobs; ++thread_id) {
+      tasks.push_back(engine::AsyncNoSpan([&, thread_id] {
+        while (keep_running) {
+          do_work(thread_id);
+        }
+      }));
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+      do_work(0);
+    }
+
+    keep_running = false;
+
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+
+BENCHMARK(mutex_set_way_collision_contention)
+    ->Args({1, 2})
+    ->Args({1, 8})
+    ->Args({8, 8})
+    ->Args({64, 8});
+
+// The control case: each task locks a key in its own way, so the only
+// contention left is the way lookup itself. Args: {ways, tasks}.
+void mutex_set_way_spread_contention(benchmark::State& state) {
+  engine::RunStandalone(state.range(1), [&] {
+    const std::size_t ways = state.range(0);
+    concurrent::MutexSet<std::size_t, IdentityHash> ms(ways);
+
+    // with the identity hash and ways >= tasks, `thread_id` selects a
+    // dedicated way per task
+    const auto do_work = [&](std::size_t thread_id) {
+      auto mutex = ms.GetMutexForKey(thread_id);
+      std::unique_lock lock(mutex);
+      benchmark::DoNotOptimize(lock);
+    };
+
+    const std::size_t concurrent_jobs = state.range(1);
+    std::atomic<bool> keep_running{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(concurrent_jobs);
+
+    for (std::size_t thread_id = 1; thread_id < concurrent_jobs; ++thread_id) {
+      tasks.push_back(engine::AsyncNoSpan([&, thread_id] {
+        while (keep_running) {
+          do_work(thread_id);
+        }
+      }));
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+      do_work(0);
+    }
+
+    keep_running = false;
+
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+
+BENCHMARK(mutex_set_way_spread_contention)
+    ->Args({8, 2})
+    ->Args({8, 8})
+    ->Args({64, 8});
+
 }  // namespace
 
 USERVER_NAMESPACE_END
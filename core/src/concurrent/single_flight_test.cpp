@@ -0,0 +1,67 @@
+#include <userver/concurrent/single_flight.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(SingleFlight, ComputesOnce) {
+  /// [Sample SingleFlight usage]
+  concurrent::SingleFlight<std::string, int> single_flight;
+
+  const auto value = single_flight.Do("key", [] { return 42; });
+  EXPECT_EQ(value, 42);
+  /// [Sample SingleFlight usage]
+}
+
+UTEST_MT(SingleFlight, ConcurrentCallersShareOneComputation, 4) {
+  concurrent::SingleFlight<std::string, int> single_flight;
+  std::atomic<int> computations{0};
+  engine::SingleConsumerEvent release;
+
+  std::vector<engine::TaskWithResult<int>> waiters;
+  waiters.reserve(4);
+  for (int i = 0; i < 4; ++i) {
+    waiters.push_back(engine::AsyncNoSpan([&] {
+      return single_flight.Do("key", [&] {
+        ++computations;
+        [[maybe_unused]] const bool woken =
+            release.WaitForEventFor(utest::kMaxTestWaitTime);
+        return 17;
+      });
+    }));
+  }
+
+  // let the waiters pile up on the single in-flight computation
+  while (single_flight.GetInFlightCount() == 0) engine::Yield();
+  release.Send();
+
+  for (auto& waiter : waiters) EXPECT_EQ(waiter.Get(), 17);
+  EXPECT_EQ(computations.load(), 1);
+  EXPECT_EQ(single_flight.GetInFlightCount(), 0);
+}
+
+UTEST(SingleFlight, ExceptionPropagatesAndRetires) {
+  concurrent::SingleFlight<std::string, int> single_flight;
+
+  UEXPECT_THROW(single_flight.Do(
+                    "key", []() -> int { throw std::runtime_error{"fail"}; }),
+                std::runtime_error);
+
+  // a failed computation does not poison the key
+  EXPECT_EQ(single_flight.Do("key", [] { return 1; }), 1);
+}
+
+UTEST(SingleFlight, SequentialCallsComputeAfresh) {
+  concurrent::SingleFlight<std::string, int> single_flight;
+
+  EXPECT_EQ(single_flight.Do("key", [] { return 1; }), 1);
+  EXPECT_EQ(single_flight.Do("key", [] { return 2; }), 2);
+}
+
+USERVER_NAMESPACE_END
@@ -240,6 +240,8 @@ void easy::reset() {
   if (http200_aliases_) http200_aliases_->clear();
   if (resolved_hosts_) resolved_hosts_->clear();
   share_.reset();
+  streaming_source_.reset();
+  upload_paused_ = false;
   retries_count_ = 0;
   sockets_opened_ = 0;
   rate_limit_error_.clear();
@@ -286,6 +288,30 @@ void easy::set_source(std::shared_ptr<std::istream> source,
   if (!ec) set_seek_data(this, ec);
 }
 
+void easy::set_streaming_source(std::shared_ptr<streaming_source> source) {
+  std::error_code ec;
+  set_streaming_source(std::move(source), ec);
+  throw_error(ec, "set_streaming_source");
+}
+
+void easy::set_streaming_source(std::shared_ptr<streaming_source> source,
+                                std::error_code& ec) {
+  streaming_source_ = std::move(source);
+  set_read_function(&easy::read_function, ec);
+  if (!ec) set_read_data(this, ec);
+  // No seek function: a paused streaming upload cannot be rewound, curl
+  // falls back to re-sending via the read callback only.
+}
+
+void easy::resume_upload() {
+  if (!multi_) return;
+  GetThreadControl().RunInEvLoopAsync([self = shared_from_this(), this] {
+    if (!upload_paused_) return;
+    upload_paused_ = false;
+    native::curl_easy_pause(handle_, CURLPAUSE_CONT);
+  });
+}
+
 void easy::set_sink(std::string* sink) {
   std::error_code ec;
   set_sink(sink, ec);
@@ -702,6 +728,25 @@ size_t easy::read_function(void* ptr, size_t size, size_t nmemb,
   easy* self = static_cast<easy*>(userdata);
   size_t actual_size = size * nmemb;
 
+  if (self->streaming_source_) {
+    std::size_t bytes_written = 0;
+    const auto status = self->streaming_source_->Read(static_cast<char*>(ptr),
+                                                      actual_size,
+                                                      bytes_written);
+    switch (status) {
+      case streaming_source::ReadStatus::kProduced:
+        return bytes_written;
+      case streaming_source::ReadStatus::kWouldBlock:
+        self->upload_paused_ = true;
+        return CURL_READFUNC_PAUSE;
+      case streaming_source::ReadStatus::kEof:
+        return 0;
+      case streaming_source::ReadStatus::kError:
+        return CURL_READFUNC_ABORT;
+    }
+    return CURL_READFUNC_ABORT;
+  }
+
   if (!self->source_) return CURL_READFUNC_ABORT;
 
   if (self->source_->eof()) {
@@ -224,6 +224,28 @@ class easy final : public std::enable_shared_from_this<easy> {
   void reset();
   void set_source(std::shared_ptr<std::istream> source);
   void set_source(std::shared_ptr<std::istream> source, std::error_code& ec);
+
+  /// Non-blocking pull source for streaming uploads: Read() is invoked on
+  /// the ev thread and must never block. kWouldBlock pauses the transfer
+  /// until resume_upload() is called.
+  class streaming_source {
+   public:
+    enum class ReadStatus { kProduced, kWouldBlock, kEof, kError };
+
+    virtual ~streaming_source() = default;
+
+    virtual ReadStatus Read(char* buffer, std::size_t capacity,
+                            std::size_t& bytes_written) = 0;
+  };
+
+  void set_streaming_source(std::shared_ptr<streaming_source> source);
+  void set_streaming_source(std::shared_ptr<streaming_source> source,
+                            std::error_code& ec);
+
+  /// Resumes a transfer paused by streaming_source::ReadStatus::kWouldBlock.
+  /// May be called from any thread.
+  void resume_upload();
+
   void set_sink(std::string* sink);
   void set_sink(std::string* sink, std::error_code& ec);
 
@@ -836,6 +858,9 @@ class easy final : public std::enable_shared_from_this<easy> {
   url url_;
   handler_type handler_;
   std::shared_ptr<std::istream> source_;
+  std::shared_ptr<streaming_source> streaming_source_;
+  // accessed on the ev thread only
+  bool upload_paused_{false};
   std::string* sink_{nullptr};
   std::string post_fields_;
   std::shared_ptr<form> form_;
@@ -574,6 +574,19 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            compressed:
+                type: boolean
+                description: |
+                    Whether to gzip the dump with streaming (de)compression;
+                    mutually exclusive with 'encrypted'
+                defaultDescription: false
+            max-write-bandwidth:
+                type: integer
+                description: |
+                    caps the dump write rate, bytes per second, so periodic
+                    dumps of huge caches do not saturate the disk; 0 means
+                    unlimited
+                defaultDescription: 0
 )");
 }
 
@@ -1,6 +1,7 @@
 #include <userver/dump/factory.hpp>
 
 #include <dump/secdist.hpp>
+#include <userver/dump/operations_compressed.hpp>
 #include <userver/dump/operations_encrypted.hpp>
 #include <userver/dump/operations_file.hpp>
 #include <userver/storages/secdist/component.hpp>
@@ -29,16 +30,25 @@ std::unique_ptr<dump::OperationsFactory> CreateOperationsFactory(
     const auto& secdist = context.FindComponent<components::Secdist>().Get();
     auto secret_key = secdist.Get<dump::Secdist>().GetSecretKey(config.name);
     return std::make_unique<dump::EncryptedOperationsFactory>(
-        std::move(secret_key), dump_perms);
+        std::move(secret_key), dump_perms, config.max_write_bandwidth_bps);
+  } else if (config.dump_is_compressed) {
+    return std::make_unique<dump::CompressedOperationsFactory>(
+        dump_perms, config.max_write_bandwidth_bps);
   } else {
-    return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+    return std::make_unique<dump::FileOperationsFactory>(
+        dump_perms, config.max_write_bandwidth_bps);
   }
 }
 
 std::unique_ptr<dump::OperationsFactory> CreateDefaultOperationsFactory(
     const Config& config) {
   auto dump_perms = GetPerms(config);
-  return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+  if (config.dump_is_compressed) {
+    return std::make_unique<dump::CompressedOperationsFactory>(
+        dump_perms, config.max_write_bandwidth_bps);
+  }
+  return std::make_unique<dump::FileOperationsFactory>(
+      dump_perms, config.max_write_bandwidth_bps);
 }
 
 }  // namespace dump
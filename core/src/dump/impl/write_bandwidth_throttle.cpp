@@ -0,0 +1,36 @@
+#include <userver/dump/impl/write_bandwidth_throttle.hpp>
+
+#include <userver/engine/sleep.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+WriteBandwidthThrottle::WriteBandwidthThrottle(std::size_t max_bandwidth_bps)
+    : max_bandwidth_bps_(max_bandwidth_bps),
+      window_start_(std::chrono::steady_clock::now()) {}
+
+void WriteBandwidthThrottle::OnBytesWritten(std::size_t bytes_written) {
+  if (max_bandwidth_bps_ == 0 || bytes_written == 0) return;
+  bytes_in_window_ += bytes_written;
+
+  const auto now = std::chrono::steady_clock::now();
+  const std::chrono::duration<double> elapsed = now - window_start_;
+  const auto allowed_bytes =
+      elapsed.count() * static_cast<double>(max_bandwidth_bps_);
+  if (static_cast<double>(bytes_in_window_) <= allowed_bytes) return;
+
+  const auto excess_seconds =
+      (static_cast<double>(bytes_in_window_) - allowed_bytes) /
+      static_cast<double>(max_bandwidth_bps_);
+  engine::SleepFor(std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::duration<double>(excess_seconds)));
+
+  // restart the window to keep the arithmetic bounded on long dumps
+  window_start_ = std::chrono::steady_clock::now();
+  bytes_in_window_ = 0;
+}
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
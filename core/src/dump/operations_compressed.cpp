@@ -0,0 +1,162 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <fstream>
+#include <utility>
+
+#include <fmt/format.h>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+#include <userver/dump/impl/write_bandwidth_throttle.hpp>
+#include <userver/fs/blocking/write.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+struct CompressedWriter::Impl {
+  explicit Impl(std::size_t max_bandwidth_bps) : throttle(max_bandwidth_bps) {}
+
+  std::string final_path;
+  std::string tmp_path;
+  boost::filesystem::perms perms{};
+  std::ofstream file;
+  boost::iostreams::filtering_ostream stream;
+  impl::WriteBandwidthThrottle throttle;
+  std::streampos last_file_pos{0};
+};
+
+CompressedWriter::CompressedWriter(std::string path,
+                                   boost::filesystem::perms perms,
+                                   tracing::ScopeTime& /*scope*/,
+                                   std::size_t max_bandwidth_bps)
+    : impl_(std::make_unique<Impl>(max_bandwidth_bps)) {
+  impl_->final_path = std::move(path);
+  impl_->tmp_path = impl_->final_path + ".tmp";
+  impl_->perms = perms;
+
+  impl_->file.open(impl_->tmp_path,
+                   std::ios::binary | std::ios::out | std::ios::trunc);
+  if (!impl_->file) {
+    throw Error(fmt::format(
+        "Failed to open the dump file for write \"{}\"", impl_->tmp_path));
+  }
+  impl_->stream.push(boost::iostreams::gzip_compressor());
+  impl_->stream.push(impl_->file);
+}
+
+CompressedWriter::~CompressedWriter() = default;
+
+void CompressedWriter::WriteRaw(std::string_view data) {
+  try {
+    impl_->stream.write(data.data(),
+                        static_cast<std::streamsize>(data.size()));
+    if (!impl_->stream) throw std::runtime_error("stream in a failed state");
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to write to the dump file \"{}\": {}",
+                            impl_->tmp_path, ex.what()));
+  }
+
+  // throttle on the compressed bytes actually flushed to disk, not on the
+  // uncompressed input size
+  const auto pos = impl_->file.tellp();
+  if (pos != std::streampos(-1) && pos > impl_->last_file_pos) {
+    impl_->throttle.OnBytesWritten(
+        static_cast<std::size_t>(pos - impl_->last_file_pos));
+    impl_->last_file_pos = pos;
+  }
+}
+
+void CompressedWriter::Finish() {
+  try {
+    // finalizes the gzip stream before the file is closed
+    boost::iostreams::close(impl_->stream);
+    impl_->file.flush();
+    impl_->file.close();
+    if (!impl_->file) {
+      throw std::runtime_error("stream in a failed state");
+    }
+    fs::blocking::Chmod(impl_->tmp_path, impl_->perms);
+    fs::blocking::Rename(impl_->tmp_path, impl_->final_path);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to finalize dump \"{}\". Reason: {}",
+                            impl_->tmp_path, ex.what()));
+  }
+}
+
+struct CompressedReader::Impl {
+  std::string path;
+  std::ifstream file;
+  boost::iostreams::filtering_istream stream;
+  std::string curr_chunk;
+};
+
+CompressedReader::CompressedReader(std::string path)
+    : impl_(std::make_unique<Impl>()) {
+  impl_->path = std::move(path);
+  impl_->file.open(impl_->path, std::ios::binary | std::ios::in);
+  if (!impl_->file) {
+    throw Error(fmt::format(
+        "Failed to open the dump file for reading \"{}\"", impl_->path));
+  }
+  impl_->stream.push(boost::iostreams::gzip_decompressor());
+  impl_->stream.push(impl_->file);
+}
+
+CompressedReader::~CompressedReader() = default;
+
+std::string_view CompressedReader::ReadRaw(std::size_t max_size) {
+  if (impl_->curr_chunk.size() < max_size) {
+    impl_->curr_chunk.resize(max_size);
+  }
+
+  std::streamsize bytes_read = 0;
+  try {
+    // gzip filters throw on corrupt input
+    impl_->stream.read(impl_->curr_chunk.data(),
+                       static_cast<std::streamsize>(max_size));
+    bytes_read = impl_->stream.gcount();
+    if (impl_->stream.bad()) {
+      throw std::runtime_error("stream in a failed state");
+    }
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to read from the dump file \"{}\": {}",
+                            impl_->path, ex.what()));
+  }
+
+  return {impl_->curr_chunk.data(), static_cast<std::size_t>(bytes_read)};
+}
+
+void CompressedReader::Finish() {
+  char extra_byte = 0;
+  try {
+    impl_->stream.read(&extra_byte, 1);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to read from the dump file \"{}\": {}",
+                            impl_->path, ex.what()));
+  }
+  if (impl_->stream.gcount() != 0) {
+    throw Error(fmt::format(
+        "Unexpected extra data at the end of the dump file \"{}\"",
+        impl_->path));
+  }
+}
+
+CompressedOperationsFactory::CompressedOperationsFactory(
+    boost::filesystem::perms perms, std::size_t max_write_bandwidth_bps)
+    : perms_(perms), max_write_bandwidth_bps_(max_write_bandwidth_bps) {}
+
+std::unique_ptr<Reader> CompressedOperationsFactory::CreateReader(
+    std::string full_path) {
+  return std::make_unique<CompressedReader>(std::move(full_path));
+}
+
+std::unique_ptr<Writer> CompressedOperationsFactory::CreateWriter(
+    std::string full_path, tracing::ScopeTime& scope) {
+  return std::make_unique<CompressedWriter>(std::move(full_path), perms_,
+                                            scope, max_write_bandwidth_bps_);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
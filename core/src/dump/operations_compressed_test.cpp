@@ -0,0 +1,74 @@
+#include <userver/utest/utest.hpp>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_compressed.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(DumpCompressedFile, Smoke) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter w(path, boost::filesystem::perms::owner_read,
+                           scope_time);
+
+  w.Write(1);
+  UEXPECT_NO_THROW(w.Finish());
+
+  dump::CompressedReader r(path);
+  EXPECT_EQ(r.Read<int32_t>(), 1);
+
+  UEXPECT_THROW(r.Read<int32_t>(), dump::Error);
+
+  UEXPECT_NO_THROW(r.Finish());
+}
+
+UTEST(DumpCompressedFile, UnreadData) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter w(path, boost::filesystem::perms::owner_read,
+                           scope_time);
+
+  w.Write(1);
+  UEXPECT_NO_THROW(w.Finish());
+
+  dump::CompressedReader r(path);
+
+  UEXPECT_THROW(r.Finish(), dump::Error);
+}
+
+UTEST(DumpCompressedFile, LongAndCompressible) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter w(path, boost::filesystem::perms::owner_read,
+                           scope_time);
+
+  const std::string payload(1024, 'x');
+  for (int i = 0; i < 256; i++) {
+    w.Write(i);
+    w.Write(payload);
+  }
+  UEXPECT_NO_THROW(w.Finish());
+
+  // 256 KiB of repeated payload must compress well below the raw size
+  EXPECT_LT(boost::filesystem::file_size(path), 64 * 1024);
+
+  dump::CompressedReader r(path);
+  for (int i = 0; i < 256; i++) {
+    EXPECT_EQ(r.Read<int32_t>(), i);
+    EXPECT_EQ(r.Read<std::string>(), payload);
+  }
+
+  UEXPECT_NO_THROW(r.Finish());
+}
+
+USERVER_NAMESPACE_END
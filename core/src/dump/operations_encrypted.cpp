@@ -9,6 +9,7 @@
 #include <cryptopp/osrng.h>
 
 #include <userver/crypto/random.hpp>
+#include <userver/dump/impl/write_bandwidth_throttle.hpp>
 #include <userver/fs/blocking/write.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/cpu_relax.hpp>
@@ -31,10 +32,13 @@ struct EncryptedWriter::Impl {
   Encryption encryption;
   std::unique_ptr<::CryptoPP::AuthenticatedEncryptionFilter> filter;
   utils::StreamingCpuRelax cpu_relax_;
+  impl::WriteBandwidthThrottle throttle;
 
-  Impl(std::string&& filename, tracing::ScopeTime* scope)
+  Impl(std::string&& filename, tracing::ScopeTime* scope,
+       std::size_t max_bandwidth_bps)
       : filename(std::move(filename)),
-        cpu_relax_(kCheckTimeAfterBytes, scope) {}
+        cpu_relax_(kCheckTimeAfterBytes, scope),
+        throttle(max_bandwidth_bps) {}
 
   std::string GetTempFilename() const { return filename + ".tmp"; }
 };
@@ -51,8 +55,9 @@ inline const unsigned char* GetBytes(const T& data) {
 EncryptedWriter::EncryptedWriter(std::string filename,
                                  const SecretKey& secret_key,
                                  boost::filesystem::perms perms,
-                                 tracing::ScopeTime& scope)
-    : impl_(std::move(filename), &scope) {
+                                 tracing::ScopeTime& scope,
+                                 std::size_t max_bandwidth_bps)
+    : impl_(std::move(filename), &scope, max_bandwidth_bps) {
   IV iv{crypto::GenerateRandomBlock(kIvSize)};
   impl_->encryption.SetKeyWithIV(GetBytes(secret_key),
                                  secret_key.GetUnderlying().size(),
@@ -80,6 +85,9 @@ void EncryptedWriter::WriteRaw(std::string_view data) {
   impl_->filter->Put(reinterpret_cast<const unsigned char*>(data.data()),
                      data.size());
   impl_->cpu_relax_.Relax(data.size());
+  // AES-GCM ciphertext size closely tracks the plaintext size, so the
+  // plaintext byte count is an accurate proxy for disk bytes
+  impl_->throttle.OnBytesWritten(data.size());
 }
 
 void EncryptedWriter::Finish() {
@@ -177,8 +185,11 @@ void EncryptedReader::Finish() {
 }
 
 EncryptedOperationsFactory::EncryptedOperationsFactory(
-    SecretKey&& secret_key, boost::filesystem::perms perms)
-    : secret_key_(std::move(secret_key)), perms_(perms) {}
+    SecretKey&& secret_key, boost::filesystem::perms perms,
+    std::size_t max_write_bandwidth_bps)
+    : secret_key_(std::move(secret_key)),
+      perms_(perms),
+      max_write_bandwidth_bps_(max_write_bandwidth_bps) {}
 
 std::unique_ptr<Reader> EncryptedOperationsFactory::CreateReader(
     std::string full_path) {
@@ -188,7 +199,8 @@ std::unique_ptr<Reader> EncryptedOperationsFactory::CreateReader(
 std::unique_ptr<Writer> EncryptedOperationsFactory::CreateWriter(
     std::string full_path, tracing::ScopeTime& scope) {
   return std::make_unique<EncryptedWriter>(std::move(full_path), secret_key_,
-                                           perms_, scope);
+                                           perms_, scope,
+                                           max_write_bandwidth_bps_);
 }
 
 }  // namespace dump
@@ -17,11 +17,13 @@ constexpr std::size_t kCheckTimeAfterBytes{1 << 15};
 }
 
 FileWriter::FileWriter(std::string path, boost::filesystem::perms perms,
-                       tracing::ScopeTime& scope)
+                       tracing::ScopeTime& scope,
+                       std::size_t max_bandwidth_bps)
     : final_path_(std::move(path)),
       path_(final_path_ + ".tmp"),
       perms_(perms),
-      cpu_relax_(kCheckTimeAfterBytes, &scope) {
+      cpu_relax_(kCheckTimeAfterBytes, &scope),
+      throttle_(max_bandwidth_bps) {
   constexpr fs::blocking::OpenMode mode{
       fs::blocking::OpenFlag::kWrite, fs::blocking::OpenFlag::kExclusiveCreate};
   const auto tmp_perms = perms_ | boost::filesystem::perms::owner_write;
@@ -42,6 +44,7 @@ void FileWriter::WriteRaw(std::string_view data) {
                             path_, ex.what()));
   }
   cpu_relax_.Relax(data.size());
+  throttle_.OnBytesWritten(data.size());
 }
 
 void FileWriter::Finish() {
@@ -116,8 +119,9 @@ void FileReader::Finish() {
   }
 }
 
-FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms)
-    : perms_(perms) {}
+FileOperationsFactory::FileOperationsFactory(
+    boost::filesystem::perms perms, std::size_t max_write_bandwidth_bps)
+    : perms_(perms), max_write_bandwidth_bps_(max_write_bandwidth_bps) {}
 
 std::unique_ptr<Reader> FileOperationsFactory::CreateReader(
     std::string full_path) {
@@ -126,7 +130,8 @@ std::unique_ptr<Reader> FileOperationsFactory::CreateReader(
 
 std::unique_ptr<Writer> FileOperationsFactory::CreateWriter(
     std::string full_path, tracing::ScopeTime& scope) {
-  return std::make_unique<FileWriter>(std::move(full_path), perms_, scope);
+  return std::make_unique<FileWriter>(std::move(full_path), perms_, scope,
+                                      max_write_bandwidth_bps_);
 }
 
 }  // namespace dump
@@ -4,6 +4,7 @@
 #include <atomic>
 #include <cerrno>
 #include <utility>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
@@ -11,14 +12,40 @@
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/threads.hpp>
 
 #include "pool_config.hpp"
 #include "pool_stats.hpp"
+#include "stack_manager.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+// Delegates to boost's protected_fixedsize_stack and registers the mapping
+// with StackManager so that the cold tail of pooled stacks can be
+// madvise()-d away, see PoolConfig::reclaim_stacks.
+class ReclaimableStackAllocator final {
+ public:
+  explicit ReclaimableStackAllocator(std::size_t size) : impl_(size) {}
+
+  boost::context::stack_context allocate() {
+    auto ctx = impl_.allocate();
+    // ctx.sp points to the high end of the usable stack
+    StackManager::Get().Register(static_cast<char*>(ctx.sp) - ctx.size,
+                                 ctx.size);
+    return ctx;
+  }
+
+  void deallocate(boost::context::stack_context& ctx) {
+    StackManager::Get().Unregister(static_cast<char*>(ctx.sp) - ctx.size);
+    impl_.deallocate(ctx);
+  }
+
+ private:
+  boost::coroutines2::protected_fixedsize_stack impl_;
+};
+
 template <typename Task>
 class Pool final {
  public:
@@ -39,13 +66,15 @@ class Pool final {
   Coroutine CreateCoroutine(bool quiet = false);
   void OnCoroutineDestruction() noexcept;
 
+  moodycamel::ConcurrentQueue<Coroutine>& GetUsedPoolQueue();
+
   template <typename Token>
-  Token& GetUsedPoolToken();
+  Token& GetUsedPoolToken(moodycamel::ConcurrentQueue<Coroutine>& queue);
 
   const PoolConfig config_;
   const Executor executor_;
 
-  boost::coroutines2::protected_fixedsize_stack stack_allocator_;
+  ReclaimableStackAllocator stack_allocator_;
 
   // We aim to reuse coroutines as much as possible,
   // because since coroutine stack is a mmap-ed chunk of memory and not actually
@@ -54,7 +83,10 @@ class Pool final {
   // The same could've been achieved with some LIFO container, but apparently
   // we don't have a container handy enough to not just use 2 queues.
   moodycamel::ConcurrentQueue<Coroutine> initial_coroutines_;
-  moodycamel::ConcurrentQueue<Coroutine> used_coroutines_;
+  // The 'working set' is sharded by the NUMA node of the returning thread, so
+  // that task processors pinned via TaskProcessorConfig::numa_node keep stack
+  // pages node-local. On single-node systems this degrades to a single queue.
+  std::vector<moodycamel::ConcurrentQueue<Coroutine>> used_coroutines_;
 
   std::atomic<std::size_t> idle_coroutines_num_;
   std::atomic<std::size_t> total_coroutines_num_;
@@ -95,9 +127,16 @@ Pool<Task>::Pool(PoolConfig config, Executor executor)
       executor_(executor),
       stack_allocator_(config_.stack_size),
       initial_coroutines_(config_.initial_size),
-      used_coroutines_(config_.max_size),
       idle_coroutines_num_(config_.initial_size),
       total_coroutines_num_(0) {
+  StackManager::Get().SetEnabled(config_.reclaim_stacks);
+
+  const auto numa_node_count = utils::GetNumaNodeCount();
+  used_coroutines_.reserve(numa_node_count);
+  for (std::size_t node = 0; node < numa_node_count; ++node) {
+    used_coroutines_.emplace_back(config_.max_size);
+  }
+
   moodycamel::ProducerToken token(initial_coroutines_);
   for (std::size_t i = 0; i < config_.initial_size; ++i) {
     bool ok =
@@ -123,15 +162,28 @@ typename Pool<Task>::CoroutinePtr Pool<Task>::GetCoroutine() {
   std::optional<Coroutine> coroutine;
   CoroutineMover mover{coroutine};
 
-  // First try to dequeue from 'working set': if we can get a coroutine
-  // from there we are happy, because we saved on minor-page-faulting (thus
-  // increasing resident memory usage) a not-yet-de-virtualized coroutine stack.
-  if (used_coroutines_.try_dequeue(
-          GetUsedPoolToken<moodycamel::ConsumerToken>(), mover) ||
+  // First try to dequeue from the node-local 'working set': if we can get a
+  // coroutine from there we are happy, because we saved on
+  // minor-page-faulting (thus increasing resident memory usage) a
+  // not-yet-de-virtualized coroutine stack, and its pages live on our node.
+  auto& local_queue = GetUsedPoolQueue();
+  if (local_queue.try_dequeue(
+          GetUsedPoolToken<moodycamel::ConsumerToken>(local_queue), mover) ||
       initial_coroutines_.try_dequeue(mover)) {
     --idle_coroutines_num_;
   } else {
-    coroutine.emplace(CreateCoroutine());
+    // Steal an idle coroutine from another node before growing the pool: a
+    // remote stack is still cheaper than the mmap + page faults of a new one.
+    bool stolen = false;
+    for (auto& queue : used_coroutines_) {
+      if (&queue == &local_queue) continue;
+      if (queue.try_dequeue(mover)) {
+        --idle_coroutines_num_;
+        stolen = true;
+        break;
+      }
+    }
+    if (!stolen) coroutine.emplace(CreateCoroutine());
   }
   return CoroutinePtr(std::move(*coroutine), *this);
 }
@@ -139,21 +191,30 @@ typename Pool<Task>::CoroutinePtr Pool<Task>::GetCoroutine() {
 template <typename Task>
 void Pool<Task>::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
   if (idle_coroutines_num_.load() >= config_.max_size) return;
-  auto& token = GetUsedPoolToken<moodycamel::ProducerToken>();
+  auto& local_queue = GetUsedPoolQueue();
+  auto& token = GetUsedPoolToken<moodycamel::ProducerToken>(local_queue);
   const bool ok =
-      // We only ever return coroutines into our 'working set'.
-      used_coroutines_.enqueue(token, std::move(coroutine_ptr.Get()));
+      // We only ever return coroutines into the node-local 'working set'.
+      local_queue.enqueue(token, std::move(coroutine_ptr.Get()));
   if (ok) ++idle_coroutines_num_;
 }
 
 template <typename Task>
 PoolStats Pool<Task>::GetStats() const {
   PoolStats stats;
-  stats.active_coroutines =
-      total_coroutines_num_.load() -
-      (used_coroutines_.size_approx() + initial_coroutines_.size_approx());
+  std::size_t used_approx = 0;
+  for (const auto& queue : used_coroutines_) {
+    used_approx += queue.size_approx();
+  }
+  stats.active_coroutines = total_coroutines_num_.load() -
+                            (used_approx + initial_coroutines_.size_approx());
   stats.total_coroutines =
       std::max(total_coroutines_num_.load(), stats.active_coroutines);
+  stats.reserved_stack_bytes = stats.total_coroutines * config_.stack_size;
+  stats.committed_stack_bytes_estimate =
+      StackManager::Get().GetCommittedBytesEstimate();
+  stats.reclaimed_stack_bytes_total =
+      StackManager::Get().GetReclaimedBytesTotal();
   return stats;
 }
 
@@ -194,10 +255,21 @@ std::size_t Pool<Task>::GetStackSize() const {
   return config_.stack_size;
 }
 
+template <typename Task>
+moodycamel::ConcurrentQueue<typename Pool<Task>::Coroutine>&
+Pool<Task>::GetUsedPoolQueue() {
+  // The node of a worker thread is fixed before it runs any tasks, see
+  // TaskProcessor::PrepareWorkerThread.
+  const auto node =
+      static_cast<std::size_t>(utils::GetCurrentThreadNumaNode());
+  return used_coroutines_[node < used_coroutines_.size() ? node : 0];
+}
+
 template <typename Task>
 template <typename Token>
-Token& Pool<Task>::GetUsedPoolToken() {
-  thread_local Token token(used_coroutines_);
+Token& Pool<Task>::GetUsedPoolToken(
+    moodycamel::ConcurrentQueue<Coroutine>& queue) {
+  thread_local Token token(queue);
   return token;
 }
 
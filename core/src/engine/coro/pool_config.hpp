@@ -13,6 +13,9 @@ struct PoolConfig {
   std::size_t initial_size = 1000;
   std::size_t max_size = 4000;
   std::size_t stack_size = 256 * 1024ULL;
+  // Release the cold tail of pooled coroutine stacks back to the kernel
+  // between tasks, see engine::coro::StackManager
+  bool reclaim_stacks = false;
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value,
@@ -10,11 +10,17 @@ namespace engine::coro {
 struct PoolStats {
   size_t active_coroutines = 0;
   size_t total_coroutines = 0;
+  size_t reserved_stack_bytes = 0;
+  size_t committed_stack_bytes_estimate = 0;
+  size_t reclaimed_stack_bytes_total = 0;
 };
 
 inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
   lhs.active_coroutines += rhs.active_coroutines;
   lhs.total_coroutines += rhs.total_coroutines;
+  lhs.reserved_stack_bytes += rhs.reserved_stack_bytes;
+  lhs.committed_stack_bytes_estimate += rhs.committed_stack_bytes_estimate;
+  lhs.reclaimed_stack_bytes_total += rhs.reclaimed_stack_bytes_total;
   return lhs;
 }
 
@@ -0,0 +1,139 @@
+#include <engine/coro/stack_manager.hpp>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <cstdint>
+#include <mutex>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+namespace {
+
+// Reclaim at most once per this many calls per thread: between two tasks a
+// stack rarely grows back past the retain window, so a denser schedule would
+// only add madvise syscalls.
+constexpr std::size_t kReclaimPeriod = 16;
+
+// Bytes below the current stack pointer that are never reclaimed, covering
+// the executor loop frames and the next task's prologue.
+constexpr std::size_t kRedzoneBytes = 16 * 1024;
+
+std::size_t GetPageSize() noexcept {
+#ifdef __linux__
+  static const std::size_t page_size = ::sysconf(_SC_PAGESIZE);
+  return page_size;
+#else
+  return 4096;
+#endif
+}
+
+}  // namespace
+
+StackManager& StackManager::Get() noexcept {
+  static StackManager instance;
+  return instance;
+}
+
+void StackManager::SetEnabled(bool enabled) noexcept {
+  is_enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+bool StackManager::IsEnabled() const noexcept {
+  return is_enabled_.load(std::memory_order_relaxed);
+}
+
+void StackManager::Register(void* base, std::size_t size) {
+  const std::unique_lock lock(stacks_mutex_);
+  // Freshly mmap-ed stacks are lazily committed, count nothing until the
+  // first reclaim refines the estimate.
+  stacks_[base] = StackInfo{size, 0};
+}
+
+void StackManager::Unregister(void* base) noexcept {
+  const std::unique_lock lock(stacks_mutex_);
+  const auto it = stacks_.find(base);
+  if (it == stacks_.end()) return;
+  committed_bytes_estimate_.fetch_sub(it->second.committed_estimate,
+                                      std::memory_order_relaxed);
+  stacks_.erase(it);
+}
+
+void StackManager::MaybeReclaimCurrentStackTail() noexcept {
+#ifdef __linux__
+  if (!IsEnabled()) return;
+
+  thread_local std::size_t call_count = 0;
+  if (++call_count % kReclaimPeriod != 0) return;
+
+  const auto page_size = GetPageSize();
+  char local_variable{};
+  auto* const sp = &local_variable;
+
+  std::size_t old_estimate = 0;
+  std::size_t new_estimate = 0;
+  char* base = nullptr;
+  char* reclaim_end = nullptr;
+  {
+    const std::shared_lock lock(stacks_mutex_);
+    // The stack we run on is the registered region containing `sp`.
+    auto it = stacks_.upper_bound(sp);
+    if (it == stacks_.begin()) return;
+    --it;
+    base = static_cast<char*>(it->first);
+    const auto& info = it->second;
+    if (sp < base || sp >= base + info.size) return;
+
+    // Keep one page of margin at the low end (the PROT_NONE guard page sits
+    // just below the registered region with boost's protected stacks); stop
+    // a redzone short of the live frames. Everything in between is dead
+    // stack memory.
+    auto* const reclaim_begin = base + page_size;
+    reclaim_end = sp - kRedzoneBytes;
+    reclaim_end -= reinterpret_cast<std::uintptr_t>(reclaim_end) % page_size;
+    if (reclaim_end <= reclaim_begin) return;
+
+    old_estimate = info.committed_estimate;
+    // What remains committed after the reclaim: the retained hot top.
+    new_estimate = static_cast<std::size_t>(base + info.size - reclaim_end);
+  }
+
+  const auto reclaim_size = static_cast<std::size_t>(reclaim_end -
+                                                     (base + page_size));
+#ifdef MADV_FREE
+  const int advice = MADV_FREE;
+#else
+  const int advice = MADV_DONTNEED;
+#endif
+  if (::madvise(base + page_size, reclaim_size, advice) != 0) return;
+
+  reclaimed_bytes_total_.fetch_add(reclaim_size, std::memory_order_relaxed);
+
+  {
+    const std::unique_lock lock(stacks_mutex_);
+    const auto it = stacks_.find(base);
+    if (it == stacks_.end()) return;
+    it->second.committed_estimate = new_estimate;
+  }
+  committed_bytes_estimate_.fetch_add(new_estimate - old_estimate,
+                                      std::memory_order_relaxed);
+#endif
+}
+
+std::size_t StackManager::GetCommittedBytesEstimate() const noexcept {
+  return committed_bytes_estimate_.load(std::memory_order_relaxed);
+}
+
+std::size_t StackManager::GetReclaimedBytesTotal() const noexcept {
+  return reclaimed_bytes_total_.load(std::memory_order_relaxed);
+}
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
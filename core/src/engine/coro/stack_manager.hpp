@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <shared_mutex>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+// Tracks the mmap-ed stacks of pooled coroutines and releases the cold tail
+// of the current stack back to the kernel between tasks, so that a short
+// spike of deep-stacked tasks does not permanently inflate RSS. Stacks are
+// registered by the pool stack allocator; reclamation happens on the
+// coroutine stack itself, where everything below the current stack pointer
+// is dead by definition.
+class StackManager final {
+ public:
+  static StackManager& Get() noexcept;
+
+  void SetEnabled(bool enabled) noexcept;
+  bool IsEnabled() const noexcept;
+
+  void Register(void* base, std::size_t size);
+  void Unregister(void* base) noexcept;
+
+  // Releases [stack base .. current stack pointer - redzone) of the calling
+  // coroutine's stack via madvise, at most once per kReclaimPeriod calls per
+  // thread. Must be called on a registered coroutine stack. No-op when
+  // disabled or on platforms without MADV_FREE/MADV_DONTNEED.
+  void MaybeReclaimCurrentStackTail() noexcept;
+
+  // Sum of per-stack committed-bytes estimates maintained at reclaim time.
+  std::size_t GetCommittedBytesEstimate() const noexcept;
+
+  // Total bytes passed to madvise so far.
+  std::size_t GetReclaimedBytesTotal() const noexcept;
+
+ private:
+  StackManager() = default;
+
+  struct StackInfo {
+    std::size_t size{0};
+    std::size_t committed_estimate{0};
+  };
+
+  std::atomic<bool> is_enabled_{false};
+  std::atomic<std::size_t> committed_bytes_estimate_{0};
+  std::atomic<std::size_t> reclaimed_bytes_total_{0};
+
+  mutable std::shared_mutex stacks_mutex_;
+  // base address -> info; registration is a cold path (pool growth/shrink)
+  std::map<void*, StackInfo> stacks_;
+};
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
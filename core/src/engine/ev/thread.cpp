@@ -177,6 +177,13 @@ void Thread::Start() {
     ev_timer_start(loop_, &stats_timer_);
   }
 
+  // Started lazily on the first wheel timer armed on a kImmediate thread.
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  ev_timer_init(
+      &wheel_driver_, UpdateTimersWatcher, 0.0,
+      std::chrono::duration_cast<LibEvDuration>(kPeriodicEventsDriverInterval)
+          .count());
+
   if (use_ev_default_loop_) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
     ev_child_init(&watch_child_, ChildWatcher, 0, 0);
@@ -218,6 +225,7 @@ void Thread::RunEvLoop() {
   } else {
     ev_timer_stop(loop_, &stats_timer_);
   }
+  ev_timer_stop(loop_, &wheel_driver_);
   if (use_ev_default_loop_) ev_child_stop(loop_, &watch_child_);
 }
 
@@ -234,16 +242,64 @@ void Thread::UpdateTimersWatcher(struct ev_loop* loop, ev_timer*,
   ev_thread->UpdateLoopWatcherImpl();
 }
 
+TimerWheel& Thread::GetTimerWheel() noexcept {
+  UASSERT(IsInEvThread());
+  return timer_wheel_;
+}
+
+void Thread::ArmWheelTimer(TimerWheel::Timer& timer,
+                           Deadline deadline) noexcept {
+  UASSERT(IsInEvThread());
+  timer_wheel_.Arm(timer, deadline);
+
+  // Deferred-mode threads are woken up by timers_driver_ anyway; immediate
+  // ones would sleep in ev_run way past the wheel deadlines without a driver.
+  if (register_event_mode_ == RegisterEventMode::kImmediate &&
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+      !ev_is_active(&wheel_driver_)) {
+    ev_timer_start(loop_, &wheel_driver_);
+  }
+}
+
+void Thread::CancelWheelTimer(TimerWheel::Timer& timer) noexcept {
+  UASSERT(IsInEvThread());
+  timer_wheel_.Cancel(timer);
+}
+
 void Thread::UpdateLoopWatcherImpl() {
+  // The wheel tick shares the ~1ms timers_driver_ resolution in deferred
+  // mode; in immediate mode wheel_driver_ provides the wakeups.
+  timer_wheel_.Advance(TimerWheel::Clock::now());
+  if (timer_wheel_.GetArmedCount() == 0 &&
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+      ev_is_active(&wheel_driver_)) {
+    ev_timer_stop(loop_, &wheel_driver_);
+  }
+
+  std::uint64_t drained = 0;
   while (AsyncPayloadBase* payload = func_queue_.TryPop()) {
     LOG_TRACE() << "Thread::UpdateLoopWatcherImpl(), "
                 << compiler::GetTypeName(typeid(*payload));
+    ++drained;
     try {
       payload->PerformAndRelease();
     } catch (const std::exception& ex) {
       LOG_WARNING() << "exception in async thread func: " << ex;
     }
   }
+
+  if (drained != 0) {
+    drained_payloads_total_.fetch_add(drained, std::memory_order_relaxed);
+    drain_runs_total_.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+std::uint64_t Thread::GetDrainedPayloadsTotal() const noexcept {
+  return drained_payloads_total_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Thread::GetDrainRunsTotal() const noexcept {
+  return drain_runs_total_.load(std::memory_order_relaxed);
 }
 
 void Thread::BreakLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
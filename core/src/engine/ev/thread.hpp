@@ -12,6 +12,7 @@
 
 #include <concurrent/impl/intrusive_mpsc_queue.hpp>
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -52,9 +53,23 @@ class Thread final {
 
   bool IsInEvThread() const;
 
+  // The deadline timer wheel of this thread. Must only be touched from the
+  // ev thread itself; it is advanced by the loop between ev_run iterations.
+  TimerWheel& GetTimerWheel() noexcept;
+
+  // O(1) deadline timer registration in this thread's wheel. Both must be
+  // called in the ev thread.
+  void ArmWheelTimer(TimerWheel::Timer& timer, Deadline deadline) noexcept;
+  void CancelWheelTimer(TimerWheel::Timer& timer) noexcept;
+
   std::uint8_t GetCurrentLoadPercent() const;
   const std::string& GetName() const;
 
+  // Counters to observe the payload batching factor
+  // (payloads-per-wakeup == drained payloads / drain runs).
+  std::uint64_t GetDrainedPayloadsTotal() const noexcept;
+  std::uint64_t GetDrainRunsTotal() const noexcept;
+
  private:
   Thread(const std::string& thread_name, bool use_ev_default_loop,
          RegisterEventMode register_event_mode);
@@ -80,6 +95,7 @@ class Thread final {
   void ReleaseImpl() noexcept;
 
   concurrent::impl::IntrusiveMpscQueue<AsyncPayloadBase> func_queue_;
+  TimerWheel timer_wheel_{TimerWheel::Clock::now()};
 
   bool use_ev_default_loop_;
   RegisterEventMode register_event_mode_;
@@ -91,6 +107,9 @@ class Thread final {
 
   ev_timer timers_driver_{};
   ev_timer stats_timer_{};
+  // Drives the timer wheel on kImmediate threads while it has armed timers;
+  // kDeferred threads reuse timers_driver_ ticks instead.
+  ev_timer wheel_driver_{};
   ev_async watch_update_{};
   ev_async watch_break_{};
   ev_child watch_child_{};
@@ -98,6 +117,9 @@ class Thread final {
   const std::string name_;
   utils::statistics::ThreadCpuStatsStorage cpu_stats_storage_;
 
+  std::atomic<std::uint64_t> drained_payloads_total_{0};
+  std::atomic<std::uint64_t> drain_runs_total_{0};
+
   bool is_running_;
 };
 
@@ -85,6 +85,15 @@ void ThreadControlBase::DoStop(ev_io& w) noexcept {
   ev_io_stop(GetEvLoop(), &w);
 }
 
+void ThreadControlBase::DoArmTimer(TimerWheel::Timer& timer,
+                                   Deadline deadline) noexcept {
+  thread_.ArmWheelTimer(timer, deadline);
+}
+
+void ThreadControlBase::DoCancelTimer(TimerWheel::Timer& timer) noexcept {
+  thread_.CancelWheelTimer(timer);
+}
+
 TimerThreadControl::TimerThreadControl(Thread& thread) noexcept
     : ThreadControlBase{thread} {}
 
@@ -97,6 +106,17 @@ void TimerThreadControl::Stop(ev_timer& w) noexcept { DoStop(w); }
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void TimerThreadControl::Again(ev_timer& w) noexcept { DoAgain(w); }
 
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::ArmTimer(TimerWheel::Timer& timer,
+                                  Deadline deadline) noexcept {
+  DoArmTimer(timer, deadline);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::CancelTimer(TimerWheel::Timer& timer) noexcept {
+  DoCancelTimer(timer);
+}
+
 ThreadControl::ThreadControl(Thread& thread) noexcept
     : ThreadControlBase{thread} {}
 
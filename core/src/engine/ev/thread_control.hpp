@@ -9,6 +9,7 @@
 #include <ev.h>
 
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/single_use_event.hpp>
 #include <userver/engine/task/cancel.hpp>
@@ -147,6 +148,9 @@ class ThreadControlBase {
   void DoStart(ev_io& w) noexcept;
   void DoStop(ev_io& w) noexcept;
 
+  void DoArmTimer(TimerWheel::Timer& timer, Deadline deadline) noexcept;
+  void DoCancelTimer(TimerWheel::Timer& timer) noexcept;
+
  private:
   Thread& thread_;
 };
@@ -215,6 +219,11 @@ class TimerThreadControl final : public ThreadControlBase {
   void Start(ev_timer& w) noexcept;
   void Stop(ev_timer& w) noexcept;
   void Again(ev_timer& w) noexcept;
+
+  // O(1) timer wheel alternative to ev_timer for deadline timers. Must be
+  // called in the ev thread.
+  void ArmTimer(TimerWheel::Timer& timer, Deadline deadline) noexcept;
+  void CancelTimer(TimerWheel::Timer& timer) noexcept;
 };
 
 class ThreadControl final : public ThreadControlBase {
@@ -0,0 +1,111 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+TimerWheel::Timer::~Timer() {
+  UASSERT_MSG(!is_armed_, "An armed TimerWheel::Timer is being destroyed");
+}
+
+void TimerWheel::Timer::Init(Callback callback, void* data) noexcept {
+  UASSERT(!is_armed_);
+  callback_ = callback;
+  data_ = data;
+}
+
+TimerWheel::TimerWheel(Clock::time_point now) : epoch_(now) {
+  for (auto& sentinel : slots_) {
+    sentinel.prev_ = &sentinel;
+    sentinel.next_ = &sentinel;
+  }
+}
+
+TimerWheel::~TimerWheel() {
+  UASSERT_MSG(armed_count_ == 0,
+              "TimerWheel is being destroyed with armed timers");
+}
+
+std::uint64_t TimerWheel::TickOf(Clock::time_point time_point) const noexcept {
+  if (time_point <= epoch_) return 0;
+  return static_cast<std::uint64_t>((time_point - epoch_) / kTickPeriod);
+}
+
+void TimerWheel::Arm(Timer& timer, Deadline deadline) noexcept {
+  UASSERT(timer.callback_);
+  if (timer.is_armed_) Cancel(timer);
+
+  // The next Advance fires ticks up to and including its target, so due and
+  // past deadlines land in the nearest future tick.
+  std::uint64_t expiry_tick = current_tick_ + 1;
+  if (deadline.IsReachable()) {
+    const auto time_left = deadline.TimeLeft();
+    if (time_left.count() > 0) {
+      // Ticks are counted from the wheel epoch, not from the (possibly
+      // lagging) current tick, so that timers never fire early.
+      expiry_tick = std::max<std::uint64_t>(
+          TickOf(Clock::now() + time_left) + 1, current_tick_ + 1);
+    }
+  }
+
+  timer.expiry_tick_ = expiry_tick;
+  auto& sentinel = slots_[expiry_tick % kSlotCount];
+  timer.next_ = sentinel.next_;
+  timer.prev_ = &sentinel;
+  sentinel.next_->prev_ = &timer;
+  sentinel.next_ = &timer;
+  timer.is_armed_ = true;
+  ++armed_count_;
+}
+
+void TimerWheel::Cancel(Timer& timer) noexcept {
+  if (!timer.is_armed_) return;
+  timer.prev_->next_ = timer.next_;
+  timer.next_->prev_ = timer.prev_;
+  timer.prev_ = nullptr;
+  timer.next_ = nullptr;
+  timer.is_armed_ = false;
+  UASSERT(armed_count_ != 0);
+  --armed_count_;
+}
+
+void TimerWheel::FireSlot(std::size_t slot_index,
+                          std::uint64_t due_tick) noexcept {
+  auto& sentinel = slots_[slot_index];
+  auto* node = sentinel.next_;
+  while (node != &sentinel) {
+    auto* const next = node->next_;
+    if (node->expiry_tick_ <= due_tick) {
+      Cancel(*node);
+      // The callback may re-arm or destroy `node`, but not touch `next`:
+      // concurrent wheel mutations are forbidden and a re-arm lands either
+      // in a future slot or behind the sentinel we have already passed.
+      node->callback_(node->data_);
+    }
+    node = next;
+  }
+}
+
+void TimerWheel::Advance(Clock::time_point now) noexcept {
+  const auto target_tick = TickOf(now);
+  if (target_tick <= current_tick_) return;
+
+  // After a stall longer than a full revolution a single pass over all slots
+  // visits every armed timer.
+  const auto ticks_to_scan =
+      std::min<std::uint64_t>(target_tick - current_tick_, kSlotCount);
+  const auto start_tick = current_tick_;
+  current_tick_ = target_tick;
+
+  for (std::uint64_t tick = 1; tick <= ticks_to_scan; ++tick) {
+    FireSlot((start_tick + tick) % kSlotCount, target_tick);
+  }
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+// A hashed timer wheel for deadline timers. All operations must happen on a
+// single thread (the ev thread that owns the wheel). Arm and Cancel are O(1)
+// and allocation-free, which matters for the overwhelmingly common case of
+// deadline timers that are cancelled before firing; the per-tick cost is
+// bounded by the number of timers hashed into the current slot.
+class TimerWheel final {
+ public:
+  using Callback = void (*)(void* data) noexcept;
+
+  // Intrusive timer node. The node owner must keep it alive while armed and
+  // must not destroy it from a foreign thread.
+  class Timer final {
+   public:
+    Timer() = default;
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+    ~Timer();
+
+    void Init(Callback callback, void* data) noexcept;
+    bool IsArmed() const noexcept { return is_armed_; }
+
+   private:
+    friend class TimerWheel;
+
+    Callback callback_{nullptr};
+    void* data_{nullptr};
+    Timer* prev_{nullptr};
+    Timer* next_{nullptr};
+    std::uint64_t expiry_tick_{0};
+    bool is_armed_{false};
+  };
+
+  using Clock = std::chrono::steady_clock;
+
+  explicit TimerWheel(Clock::time_point now);
+  ~TimerWheel();
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  // (Re-)schedules the timer to fire at `deadline`. Timers with a reached or
+  // unreachable deadline fire on the next Advance.
+  void Arm(Timer& timer, Deadline deadline) noexcept;
+
+  // O(1), safe to call for a non-armed timer.
+  void Cancel(Timer& timer) noexcept;
+
+  // Fires every timer due by `now`. Callbacks run on the calling thread and
+  // may re-arm or destroy their timer.
+  void Advance(Clock::time_point now) noexcept;
+
+  std::size_t GetArmedCount() const noexcept { return armed_count_; }
+
+ private:
+  static constexpr std::size_t kSlotCount = 2048;  // power of two
+  static constexpr std::chrono::milliseconds kTickPeriod{1};
+
+  std::uint64_t TickOf(Clock::time_point time_point) const noexcept;
+  void FireSlot(std::size_t slot_index, std::uint64_t due_tick) noexcept;
+
+  const Clock::time_point epoch_;
+  std::uint64_t current_tick_{0};
+  std::size_t armed_count_{0};
+  // Each slot is a circular doubly-linked list with a sentinel node.
+  Timer slots_[kSlotCount];
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
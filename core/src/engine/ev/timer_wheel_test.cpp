@@ -0,0 +1,117 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <chrono>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using TimerWheel = engine::ev::TimerWheel;
+using Clock = TimerWheel::Clock;
+
+struct FireCounter final {
+  int fired{0};
+
+  static void OnFire(void* data) noexcept {
+    ++static_cast<FireCounter*>(data)->fired;
+  }
+};
+
+engine::Deadline After(Clock::time_point now, std::chrono::milliseconds ms) {
+  return engine::Deadline::FromTimePoint(now + ms);
+}
+
+}  // namespace
+
+UTEST(TimerWheel, FiresDueTimers) {
+  const auto start = Clock::now();
+  TimerWheel wheel{start};
+
+  FireCounter counter;
+  TimerWheel::Timer timer;
+  timer.Init(&FireCounter::OnFire, &counter);
+
+  wheel.Arm(timer, After(Clock::now(), std::chrono::milliseconds{5}));
+  EXPECT_TRUE(timer.IsArmed());
+  EXPECT_EQ(wheel.GetArmedCount(), 1);
+
+  wheel.Advance(Clock::now() + std::chrono::milliseconds{100});
+  EXPECT_EQ(counter.fired, 1);
+  EXPECT_FALSE(timer.IsArmed());
+  EXPECT_EQ(wheel.GetArmedCount(), 0);
+}
+
+UTEST(TimerWheel, DoesNotFireEarly) {
+  const auto start = Clock::now();
+  TimerWheel wheel{start};
+
+  FireCounter counter;
+  TimerWheel::Timer timer;
+  timer.Init(&FireCounter::OnFire, &counter);
+
+  wheel.Arm(timer, After(Clock::now(), std::chrono::seconds{30}));
+  wheel.Advance(Clock::now() + std::chrono::milliseconds{10});
+  EXPECT_EQ(counter.fired, 0);
+  EXPECT_TRUE(timer.IsArmed());
+
+  wheel.Cancel(timer);
+  EXPECT_EQ(wheel.GetArmedCount(), 0);
+}
+
+UTEST(TimerWheel, CancelIsIdempotent) {
+  TimerWheel wheel{Clock::now()};
+
+  FireCounter counter;
+  TimerWheel::Timer timer;
+  timer.Init(&FireCounter::OnFire, &counter);
+
+  wheel.Cancel(timer);  // cancelling a never-armed timer is a no-op
+
+  wheel.Arm(timer, After(Clock::now(), std::chrono::milliseconds{1}));
+  wheel.Cancel(timer);
+  wheel.Cancel(timer);
+
+  wheel.Advance(Clock::now() + std::chrono::seconds{1});
+  EXPECT_EQ(counter.fired, 0);
+}
+
+UTEST(TimerWheel, RearmMovesTheTimer) {
+  TimerWheel wheel{Clock::now()};
+
+  FireCounter counter;
+  TimerWheel::Timer timer;
+  timer.Init(&FireCounter::OnFire, &counter);
+
+  wheel.Arm(timer, After(Clock::now(), std::chrono::milliseconds{1}));
+  wheel.Arm(timer, After(Clock::now(), std::chrono::seconds{30}));
+  EXPECT_EQ(wheel.GetArmedCount(), 1);
+
+  wheel.Advance(Clock::now() + std::chrono::seconds{1});
+  EXPECT_EQ(counter.fired, 0);
+
+  wheel.Advance(Clock::now() + std::chrono::seconds{31});
+  EXPECT_EQ(counter.fired, 1);
+}
+
+UTEST(TimerWheel, LongStallFiresEverything) {
+  TimerWheel wheel{Clock::now()};
+
+  constexpr std::size_t kTimers = 100;
+  FireCounter counter;
+  TimerWheel::Timer timers[kTimers];
+  for (std::size_t i = 0; i < kTimers; ++i) {
+    timers[i].Init(&FireCounter::OnFire, &counter);
+    wheel.Arm(timers[i],
+              After(Clock::now(),
+                    std::chrono::milliseconds{1 + static_cast<int>(i) * 37}));
+  }
+
+  // A stall much longer than a full wheel revolution
+  wheel.Advance(Clock::now() + std::chrono::hours{1});
+  EXPECT_EQ(counter.fired, static_cast<int>(kTimers));
+  EXPECT_EQ(wheel.GetArmedCount(), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -393,6 +393,56 @@ UTEST(Future, WaitAnyPromiseKilledInOtherThread) {
   UEXPECT_THROW(future.get(), std::future_error);
 }
 
+UTEST(Future, ThenRunsInlineWhenAlreadyReady) {
+  engine::Promise<int> promise;
+  auto future = promise.get_future();
+  promise.set_value(42);
+
+  int result = 0;
+  std::move(future).Then(
+      [&result](engine::Future<int>&& ready) { result = ready.get(); });
+  EXPECT_EQ(result, 42);
+}
+
+UTEST(Future, ThenRunsOnCompletingThread) {
+  engine::Promise<int> promise;
+  auto future = promise.get_future();
+
+  engine::SingleConsumerEvent continuation_done;
+  int result = 0;
+  std::move(future).Then([&](engine::Future<int>&& ready) {
+    result = ready.get();
+    continuation_done.Send();
+  });
+
+  promise.set_value(17);
+  EXPECT_TRUE(continuation_done.WaitForEvent());
+  EXPECT_EQ(result, 17);
+}
+
+UTEST(Future, ThenReceivesException) {
+  engine::Promise<int> promise;
+  auto future = promise.get_future();
+
+  bool got_exception = false;
+  std::move(future).Then([&](engine::Future<int>&& ready) {
+    try {
+      ready.get();
+    } catch (const std::runtime_error&) {
+      got_exception = true;
+    }
+  });
+
+  promise.set_exception(std::make_exception_ptr(std::runtime_error{"oops"}));
+  EXPECT_TRUE(got_exception);
+}
+
+UTEST(Future, ThenOnInvalidFutureThrows) {
+  engine::Future<int> future;
+  UEXPECT_THROW(std::move(future).Then([](engine::Future<int>&&) {}),
+                std::future_error);
+}
+
 TYPED_UTEST(Future, AssignmentSendsBrokenPromise) {
   engine::Promise<TypeParam> promise;
   auto future = promise.get_future();
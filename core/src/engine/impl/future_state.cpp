@@ -7,6 +7,7 @@
 #include <engine/task/task_context.hpp>
 #include <userver/engine/exception.hpp>
 #include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -50,6 +51,33 @@ void FutureStateBase::LockResultStore() {
 void FutureStateBase::ReleaseResultStore() {
   is_ready_.store(true);
   finish_waiters_->WakeupOne();
+  TryRunContinuation();
+}
+
+void FutureStateBase::SetContinuation(
+    std::unique_ptr<FutureContinuation>&& continuation) {
+  UASSERT(continuation);
+  UASSERT_MSG(continuation_state_.load() == ContinuationState::kNone,
+              "At most one continuation may be attached to a Future");
+  continuation_ = std::move(continuation);
+  // seq_cst on both continuation_state_ and is_ready_ accesses: with weaker
+  // orderings the producer could read kNone while we read !is_ready_
+  // (StoreLoad reordering on two independent atomics), losing the
+  // continuation entirely.
+  continuation_state_.store(ContinuationState::kSet);
+
+  // The result may have been published concurrently with (or before) the
+  // store above; whoever wins the CAS in TryRunContinuation runs it.
+  if (is_ready_.load()) TryRunContinuation();
+}
+
+void FutureStateBase::TryRunContinuation() noexcept {
+  auto expected = ContinuationState::kSet;
+  if (continuation_state_.compare_exchange_strong(expected,
+                                                  ContinuationState::kDone)) {
+    const auto continuation = std::move(continuation_);
+    continuation->Run();
+  }
 }
 
 void FutureStateBase::WaitForResult() {
@@ -54,7 +54,7 @@ class WaitAnyWaitStrategy final : public WaitStrategy {
   const utils::span<ContextAccessor*> targets_;
 };
 
-inline bool AreUniqueValues(utils::span<ContextAccessor*> targets) {
+inline bool AreUniqueValues(utils::span<ContextAccessor* const> targets) {
   std::vector<ContextAccessor*> sorted;
   sorted.reserve(targets.size());
   std::copy_if(targets.begin(), targets.end(), std::back_inserter(sorted),
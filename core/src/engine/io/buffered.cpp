@@ -4,6 +4,7 @@
 
 #include <engine/io/impl/buffer.hpp>
 #include <userver/engine/io/exception.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -120,6 +121,23 @@ void BufferedReader::Discard(size_t num_bytes, Deadline deadline) {
   }
 }
 
+std::string_view BufferedReader::PeekAvailable(size_t min_bytes,
+                                               Deadline deadline) {
+  if (buffer_->AvailableReadBytes() < min_bytes) {
+    buffer_->Reserve(min_bytes - buffer_->AvailableReadBytes());
+    while (buffer_->AvailableReadBytes() < min_bytes) {
+      if (!FillBuffer(deadline)) break;
+    }
+  }
+  return {buffer_->ReadPtr(), buffer_->AvailableReadBytes()};
+}
+
+void BufferedReader::Consume(size_t num_bytes) noexcept {
+  UASSERT_MSG(num_bytes <= buffer_->AvailableReadBytes(),
+              "Consume of bytes that were never buffered");
+  buffer_->ReportRead(std::min(num_bytes, buffer_->AvailableReadBytes()));
+}
+
 size_t BufferedReader::FillBuffer(Deadline deadline) {
   try {
     auto read_bytes = source_->ReadSome(
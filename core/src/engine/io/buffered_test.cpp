@@ -104,4 +104,34 @@ TEST(BufferedReader, GetPeek) {
   EXPECT_EQ(EOF, reader.Peek());
 }
 
+TEST(BufferedReader, PeekAvailableConsume) {
+  auto mock_ptr = std::make_shared<ReadableMock>();
+  BufferedReader reader(mock_ptr);
+
+  mock_ptr->Feed("key=value\n");
+  const auto view = reader.PeekAvailable(10);
+  ASSERT_EQ(view.size(), 10);
+  EXPECT_EQ(view, "key=value\n");
+
+  // in-place parsing: consume only what the parser recognized
+  reader.Consume(4);
+  EXPECT_EQ(reader.PeekAvailable(1), "value\n");
+
+  reader.Consume(6);
+  EXPECT_EQ(reader.PeekAvailable(1), "");
+  EXPECT_EQ(EOF, reader.Peek());
+}
+
+TEST(BufferedReader, PeekAvailableEof) {
+  auto mock_ptr = std::make_shared<ReadableMock>();
+  BufferedReader reader(mock_ptr);
+
+  mock_ptr->Feed("ab");
+  // EOF before min_bytes: returns what is there
+  EXPECT_EQ(reader.PeekAvailable(10), "ab");
+
+  reader.Consume(2);
+  EXPECT_EQ(reader.PeekAvailable(1), "");
+}
+
 USERVER_NAMESPACE_END
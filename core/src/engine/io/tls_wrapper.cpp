@@ -2,7 +2,12 @@
 
 #include <boost/stacktrace/stacktrace.hpp>
 #include <exception>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 #include <openssl/bio.h>
@@ -226,6 +231,53 @@ SslCtx MakeSslCtx() {
   return ssl_ctx;
 }
 
+struct SslSessionDeleter {
+  void operator()(SSL_SESSION* session) const noexcept {
+    SSL_SESSION_free(session);
+  }
+};
+using SslSession = std::unique_ptr<SSL_SESSION, SslSessionDeleter>;
+
+// Client-side TLS session cache for resumed handshakes, keyed by server
+// name. TLS 1.3 servers deliver tickets after the handshake, so the session
+// grabbed right after SSL_connect may only enable resumption against
+// TLS <= 1.2 peers; a failed resumption silently falls back to a full
+// handshake.
+class ClientSessionCache final {
+ public:
+  static ClientSessionCache& Instance() {
+    static ClientSessionCache cache;
+    return cache;
+  }
+
+  void ApplySessionTo(SSL& ssl, const std::string& server_name) {
+    const std::lock_guard lock(mutex_);
+    const auto it = sessions_.find(server_name);
+    if (it == sessions_.end()) return;
+    // SSL_set_session takes its own reference
+    SSL_set_session(&ssl, it->second.get());
+  }
+
+  void StoreSessionFrom(SSL& ssl, const std::string& server_name) {
+    SslSession session{SSL_get1_session(&ssl)};
+    if (!session) return;
+    const std::lock_guard lock(mutex_);
+    if (sessions_.size() >= kMaxSessions &&
+        sessions_.find(server_name) == sessions_.end()) {
+      // Primitive overflow protection: the cache is expected to hold one
+      // session per upstream, which is way below the limit.
+      sessions_.clear();
+    }
+    sessions_[server_name] = std::move(session);
+  }
+
+ private:
+  static constexpr std::size_t kMaxSessions = 1024;
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, SslSession> sessions_;
+};
+
 enum InterruptAction {
   kPass,
   kFail,
@@ -269,7 +321,9 @@ class TlsWrapper::Impl {
     SyncBioData(SSL_get_rbio(ssl.get()), &other.bio_data);
   }
 
-  void SetUp(SslCtx&& ssl_ctx) {
+  // SSL_new takes its own reference on the context, the caller (or a shared
+  // context cache) retains ownership.
+  void SetUp(SSL_CTX& ssl_ctx) {
     Bio socket_bio{BIO_new(GetSocketBioMethod())};
     if (!socket_bio) {
       throw TlsException(
@@ -279,7 +333,7 @@ class TlsWrapper::Impl {
     SyncBioData(socket_bio.get(), nullptr);
     BIO_set_init(socket_bio.get(), 1);
 
-    ssl.reset(SSL_new(ssl_ctx.get()));
+    ssl.reset(SSL_new(&ssl_ctx));
     if (!ssl) {
       throw TlsException(
           crypto::FormatSslError("Failed to set up TLS wrapper: SSL_new"));
@@ -444,7 +498,7 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
   }
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->SetUp(*ssl_ctx);
   if (!server_name.empty()) {
     // cast in openssl1.0 macro expansion
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
@@ -453,6 +507,12 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
       throw TlsException(crypto::FormatSslError(
           "Failed to set up client TLS wrapper: SSL_set_tlsext_host_name"));
     }
+
+    // Try to resume a cached session instead of a full handshake. The
+    // session is only reused for the same server name, so the certificate
+    // verification setup above matches the one the session was created with.
+    ClientSessionCache::Instance().ApplySessionTo(*wrapper.impl_->ssl,
+                                                  server_name);
   }
 
   wrapper.impl_->bio_data.current_deadline = deadline;
@@ -467,18 +527,24 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
         fmt::format("Failed to set up client TLS wrapper ({})",
                     SSL_get_error(wrapper.impl_->ssl.get(), ret))));
   }
+
+  if (!server_name.empty()) {
+    ClientSessionCache::Instance().StoreSessionFrom(*wrapper.impl_->ssl,
+                                                    server_name);
+  }
   return wrapper;
 }
 
-TlsWrapper TlsWrapper::StartTlsServer(
-    Socket&& socket, const crypto::Certificate& cert,
-    const crypto::PrivateKey& key, Deadline deadline,
-    const std::vector<crypto::Certificate>& cert_authorities) {
+namespace {
+
+SslCtx MakeServerSslCtx(const crypto::Certificate& cert,
+                        const crypto::PrivateKey& key,
+                        const std::vector<crypto::Certificate>& cas) {
   auto ssl_ctx = MakeSslCtx();
 
-  if (!cert_authorities.empty()) {
+  if (!cas.empty()) {
     auto* store = SSL_CTX_get_cert_store(ssl_ctx.get());
-    for (const auto& ca : cert_authorities) {
+    for (const auto& ca : cas) {
       if (1 != X509_STORE_add_cert(store, ca.GetNative())) {
         throw TlsException(crypto::FormatSslError(
             "Failed to set up server TLS wrapper: X509_STORE_add_cert"));
@@ -502,8 +568,86 @@ TlsWrapper TlsWrapper::StartTlsServer(
         "Failed to set up server TLS wrapper: SSL_CTX_use_PrivateKey"));
   }
 
+  // Required for the server-side session cache with client certificates;
+  // the cache itself and the ticket key are per-context, which is why the
+  // contexts are shared between connections below.
+  static const unsigned char kSessionIdContext[] = "userver-tls-server";
+  SSL_CTX_set_session_id_context(ssl_ctx.get(), kSessionIdContext,
+                                 sizeof(kSessionIdContext) - 1);
+
+  return ssl_ctx;
+}
+
+// Server SSL_CTXs are shared between connections with the same credentials.
+// This enables cross-connection TLS session resumption: OpenSSL's session
+// cache and the auto-generated ticket key live in the context, so a fresh
+// context per connection would make every handshake a full one. Entries pin
+// the credentials, so native pointer keys cannot alias recycled objects.
+class ServerSslCtxCache final {
+ public:
+  static ServerSslCtxCache& Instance() {
+    static ServerSslCtxCache cache;
+    return cache;
+  }
+
+  // Returns an owning reference, so the context stays valid even if the
+  // cache entry is evicted concurrently.
+  SslCtx GetOrCreate(const crypto::Certificate& cert,
+                     const crypto::PrivateKey& key,
+                     const std::vector<crypto::Certificate>& cas) {
+    Key map_key{cert.GetNative(), key.GetNative(), {}};
+    auto& ca_pointers = std::get<2>(map_key);
+    ca_pointers.reserve(cas.size());
+    for (const auto& ca : cas) ca_pointers.push_back(ca.GetNative());
+
+    const std::lock_guard lock(mutex_);
+    auto it = entries_.find(map_key);
+    if (it == entries_.end()) {
+      if (entries_.size() >= kMaxEntries) {
+        // Certificate rotations over a long uptime must not pin credentials
+        // forever. Live connections keep their contexts referenced.
+        entries_.clear();
+      }
+      Entry entry{MakeServerSslCtx(cert, key, cas), cert, key, cas};
+      it = entries_.emplace(std::move(map_key), std::move(entry)).first;
+    }
+
+    auto* const ctx = it->second.ssl_ctx.get();
+#if OPENSSL_VERSION_NUMBER >= 0x010100000L
+    SSL_CTX_up_ref(ctx);
+#else
+    CRYPTO_add(&ctx->references, 1, CRYPTO_LOCK_SSL_CTX);
+#endif
+    return SslCtx{ctx};
+  }
+
+ private:
+  static constexpr std::size_t kMaxEntries = 64;
+
+  using Key = std::tuple<X509*, EVP_PKEY*, std::vector<X509*>>;
+
+  struct Entry final {
+    SslCtx ssl_ctx;
+    crypto::Certificate cert;
+    crypto::PrivateKey key;
+    std::vector<crypto::Certificate> cas;
+  };
+
+  std::mutex mutex_;
+  std::map<Key, Entry> entries_;
+};
+
+}  // namespace
+
+TlsWrapper TlsWrapper::StartTlsServer(
+    Socket&& socket, const crypto::Certificate& cert,
+    const crypto::PrivateKey& key, Deadline deadline,
+    const std::vector<crypto::Certificate>& cert_authorities) {
+  const auto ssl_ctx =
+      ServerSslCtxCache::Instance().GetOrCreate(cert, key, cert_authorities);
+
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->SetUp(*ssl_ctx);
   wrapper.impl_->bio_data.current_deadline = deadline;
 
   auto ret = SSL_accept(wrapper.impl_->ssl.get());
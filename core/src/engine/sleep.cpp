@@ -34,6 +34,14 @@ void SleepUntil(Deadline deadline) {
 
 void Yield() { SleepUntil(Deadline::Passed()); }
 
+bool YieldIfSliceExceeded(std::chrono::milliseconds slice_budget) {
+  if (!current_task::GetCurrentTaskContext().HasSliceExceeded(slice_budget)) {
+    return false;
+  }
+  Yield();
+  return true;
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
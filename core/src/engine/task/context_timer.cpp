@@ -64,27 +64,20 @@ class ContextTimer::Impl final : public TimerArmer<Impl>,
  private:
   void StopTimerInEvThread() noexcept;
 
-  static void OnTimer(struct ev_loop*, ev_timer* w, int) noexcept;
+  static void OnTimer(void* data) noexcept;
   static void InvokeTimerFunction(const Params& params, TaskContext& context);
   void DoOnTimer();
 
   boost::intrusive_ptr<TaskContext> context_;
   ev::TimerThreadControl* thread_control_ = nullptr;
   Params params_;
-  ev_timer timer_{};
+  ev::TimerWheel::Timer timer_;
   ev::DataPipeToEv<Params> params_pipe_to_ev_;
 };
 
-ContextTimer::Impl::Impl() {
-  timer_.data = this;
-  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
-  ev_init(&timer_, OnTimer);
-}
+ContextTimer::Impl::Impl() { timer_.Init(OnTimer, this); }
 
-ContextTimer::Impl::~Impl() {
-  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
-  UASSERT(!ev_is_active(&timer_));
-}
+ContextTimer::Impl::~Impl() { UASSERT(!timer_.IsArmed()); }
 
 bool ContextTimer::Impl::WasStarted() const noexcept {
   return context_ && thread_control_;
@@ -136,21 +129,14 @@ void ContextTimer::Impl::DoArmTimerInEvThread() {
 
   params_ = std::move(*params);
 
-  using LibEvDuration = std::chrono::duration<double>;
-  const auto time_left =
-      std::chrono::duration_cast<LibEvDuration>(params_.deadline.TimeLeft())
-          .count();
-
-  LOG_TRACE() << "time_left=" << time_left;
-  if (time_left <= 0.0) {
+  if (params_.deadline.IsReached()) {
     // Optimization for small deadlines or high load
     DoOnTimer();
     return;
   }
 
-  timer_.repeat = time_left;
   UASSERT(thread_control_);
-  thread_control_->Again(timer_);
+  thread_control_->ArmTimer(timer_, params_.deadline);
 }
 
 void ContextTimer::Impl::InvokeTimerFunction(const Params& params,
@@ -170,7 +156,7 @@ void ContextTimer::Impl::InvokeTimerFunction(const Params& params,
 
 void ContextTimer::Impl::StopTimerInEvThread() noexcept {
   UASSERT(!engine::current_task::IsTaskProcessorThread());
-  thread_control_->Stop(timer_);
+  thread_control_->CancelTimer(timer_);
 }
 
 void ContextTimer::Impl::DoFinalizeInEvThread() {
@@ -185,12 +171,12 @@ void ContextTimer::Impl::DoFinalizeInEvThread() {
   // ContextTimer may be destroyed at this point
 }
 
-void ContextTimer::Impl::OnTimer(struct ev_loop*, ev_timer* w, int) noexcept {
+void ContextTimer::Impl::OnTimer(void* data) noexcept {
   UASSERT(!engine::current_task::IsTaskProcessorThread());
 
-  auto* ev_timer = static_cast<Impl*>(w->data);
-  UASSERT(ev_timer != nullptr);
-  ev_timer->DoOnTimer();
+  auto* timer_impl = static_cast<Impl*>(data);
+  UASSERT(timer_impl != nullptr);
+  timer_impl->DoOnTimer();
 }
 
 void ContextTimer::Impl::DoOnTimer() {
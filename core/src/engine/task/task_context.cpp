@@ -195,6 +195,9 @@ void TaskContext::WaitUntil(Deadline deadline) const {
 void TaskContext::DoStep() {
   if (IsFinished()) return;
 
+  // execution-slice accounting for cooperative auto-yield, see ShouldYield
+  slice_started_ = utils::datetime::SteadyCoarseClock::now();
+
   SleepState::Flags clear_flags{SleepFlags::kSleeping};
   if (!coro_) {
     coro_ = task_processor_.GetCoroutine();
@@ -527,6 +530,10 @@ void TaskContext::CoroFunc(TaskPipe& task_pipe) {
 
     context->task_pipe_ = nullptr;
     context->TsanAcquireBarrier();
+
+    // We are at the top of this coroutine's stack between two tasks: release
+    // the cold tail of the stack back to the kernel if configured to.
+    coro::StackManager::Get().MaybeReclaimCurrentStackTail();
   }
 }
 
@@ -24,6 +24,7 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/datetime/steady_coarse_clock.hpp>
 #include <userver/utils/flags.hpp>
 #include <userver/utils/impl/wrapped_call_base.hpp>
 
@@ -105,6 +106,13 @@ class TaskContext final : public ContextAccessor {
   // simultaneously
   bool IsSharedWaitAllowed() const;
 
+  // whether the current execution slice (time since the last scheduling
+  // point) exceeded the budget; used for cooperative auto-yield
+  bool HasSliceExceeded(std::chrono::milliseconds budget) const noexcept {
+    return utils::datetime::SteadyCoarseClock::now() - slice_started_ >=
+           budget;
+  }
+
   // whether user code finished executing, coroutine may still be running
   bool IsFinished() const noexcept {
     return state_ == Task::State::kCompleted ||
@@ -235,6 +243,7 @@ class TaskContext final : public ContextAccessor {
   // {} if not defined
   std::chrono::steady_clock::time_point task_queue_wait_timepoint_;
   std::chrono::steady_clock::time_point execute_started_;
+  utils::datetime::SteadyCoarseClock::time_point slice_started_{};
   std::chrono::steady_clock::time_point last_state_change_timepoint_;
 
   std::size_t trace_csw_left_;
@@ -4,6 +4,7 @@
 
 #include <userver/compiler/thread_local.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/histogram_aggregator.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -50,7 +51,7 @@ TaskCounter::CoroToken& TaskCounter::CoroToken::operator=(
 }
 
 TaskCounter::TaskCounter(std::size_t thread_count)
-    : local_counters_(thread_count) {}
+    : local_counters_(thread_count), local_histograms_(thread_count) {}
 
 TaskCounter::~TaskCounter() { UASSERT(!MayHaveTasksAlive()); }
 
@@ -145,6 +146,37 @@ void TaskCounter::AccountSpuriousWakeup() noexcept {
   Increment(LocalCounterId::kSpuriousWakeups);
 }
 
+void TaskCounter::AccountTaskQueueWaitTime(
+    std::chrono::microseconds wait_time) noexcept {
+  auto local_data = local_task_counter_data.Use();
+  UASSERT(local_data->local_counter == this);
+  (*local_histograms_[local_data->task_processor_thread_index])
+      .queue_wait_times.Account(static_cast<double>(wait_time.count()));
+}
+
+void TaskCounter::AccountTaskQueueDepth(std::size_t depth) noexcept {
+  auto local_data = local_task_counter_data.Use();
+  UASSERT(local_data->local_counter == this);
+  (*local_histograms_[local_data->task_processor_thread_index])
+      .queue_depths.Account(static_cast<double>(depth));
+}
+
+utils::statistics::Histogram TaskCounter::GetTaskQueueWaitTimes() const {
+  utils::statistics::HistogramAggregator aggregator{kQueueWaitBoundsUs};
+  for (const auto& histograms : local_histograms_) {
+    aggregator.Add((*histograms).queue_wait_times.GetView());
+  }
+  return utils::statistics::Histogram{aggregator.GetView()};
+}
+
+utils::statistics::Histogram TaskCounter::GetTaskQueueDepths() const {
+  utils::statistics::HistogramAggregator aggregator{kQueueDepthBounds};
+  for (const auto& histograms : local_histograms_) {
+    aggregator.Add((*histograms).queue_depths.GetView());
+  }
+  return utils::statistics::Histogram{aggregator.GetView()};
+}
+
 Rate TaskCounter::GetApproximate(LocalCounterId id) const noexcept {
   Rate total;
   for (const auto& local_counters_block : local_counters_) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <cstddef>
 
 #include <boost/range/adaptor/transformed.hpp>
@@ -10,6 +11,7 @@
 #include <userver/concurrent/impl/striped_read_indicator.hpp>
 #include <userver/concurrent/striped_counter.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -85,6 +87,17 @@ class TaskCounter final {
 
   void AccountSpuriousWakeup() noexcept;
 
+  // Scheduling-latency instrumentation. Recording goes into the thread's own
+  // histogram stripe, so the hot path never contends with other workers.
+  void AccountTaskQueueWaitTime(std::chrono::microseconds wait_time) noexcept;
+
+  void AccountTaskQueueDepth(std::size_t depth) noexcept;
+
+  // Aggregated over all worker-thread stripes.
+  utils::statistics::Histogram GetTaskQueueWaitTimes() const;
+
+  utils::statistics::Histogram GetTaskQueueDepths() const;
+
  private:
   // Counters that may be mutated from outside the bound TaskProcessor.
   enum class GlobalCounterId : std::size_t {
@@ -118,6 +131,21 @@ class TaskCounter final {
   using LocalCounterPack = concurrent::impl::InterferenceShield<
       std::array<Counter, kLocalCountersSize>>;
 
+  static constexpr double kQueueWaitBoundsUs[]{
+      50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000,
+  };
+  static constexpr double kQueueDepthBounds[]{
+      1, 2, 5, 10, 25, 50, 100, 250, 500, 1000, 5000,
+  };
+
+  struct LocalHistograms final {
+    utils::statistics::Histogram queue_wait_times{kQueueWaitBoundsUs};
+    utils::statistics::Histogram queue_depths{kQueueDepthBounds};
+  };
+
+  using LocalHistogramPack =
+      concurrent::impl::InterferenceShield<LocalHistograms>;
+
   using GlobalCounterPack =
       std::array<concurrent::StripedCounter, kGlobalCountersSize>;
 
@@ -131,6 +159,7 @@ class TaskCounter final {
 
   GlobalCounterPack global_counters_;
   utils::FixedArray<LocalCounterPack> local_counters_;
+  utils::FixedArray<LocalHistogramPack> local_histograms_;
   concurrent::impl::StripedReadIndicator tasks_alive_;
 };
 
@@ -0,0 +1,84 @@
+#include <userver/engine/task/task_local_arena.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+#include <userver/engine/task/local_variable.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+TaskLocalVariable<TaskLocalArena> task_local_arena;
+
+constexpr std::size_t kInitialChunkSize = 4 * 1024;
+constexpr std::size_t kMaxChunkSize = 256 * 1024;
+
+std::size_t AlignUp(std::size_t value, std::size_t alignment) noexcept {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace
+
+TaskLocalArena& TaskLocalArena::OfCurrentTask() { return *task_local_arena; }
+
+TaskLocalArena::~TaskLocalArena() {
+  auto* chunk = head_chunk_;
+  while (chunk) {
+    auto* const previous = chunk->previous;
+    ::operator delete(chunk);
+    chunk = previous;
+  }
+}
+
+void* TaskLocalArena::Allocate(std::size_t bytes, std::size_t alignment) {
+  UASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+  if (auto* ptr = TryAllocateInChunk(bytes, alignment)) {
+    allocated_bytes_ += bytes;
+    return ptr;
+  }
+
+  AddChunk(bytes + alignment);
+  auto* const ptr = TryAllocateInChunk(bytes, alignment);
+  UASSERT(ptr);
+  allocated_bytes_ += bytes;
+  return ptr;
+}
+
+void* TaskLocalArena::TryAllocateInChunk(std::size_t bytes,
+                                         std::size_t alignment) noexcept {
+  if (!head_chunk_) return nullptr;
+
+  const auto chunk_begin =
+      reinterpret_cast<std::uintptr_t>(head_chunk_) + sizeof(Chunk);
+  const auto cursor =
+      AlignUp(chunk_begin + head_chunk_->used, alignment) - chunk_begin;
+  if (cursor + bytes > head_chunk_->size) return nullptr;
+
+  head_chunk_->used = cursor + bytes;
+  return reinterpret_cast<void*>(chunk_begin + cursor);
+}
+
+void TaskLocalArena::AddChunk(std::size_t min_payload_size) {
+  next_chunk_size_ = next_chunk_size_ == 0
+                         ? kInitialChunkSize
+                         : std::min(next_chunk_size_ * 2, kMaxChunkSize);
+  const auto payload_size = std::max(next_chunk_size_, min_payload_size);
+
+  // In-chunk alignment is computed on absolute addresses, so the plain
+  // fundamental alignment of operator new is enough here; over-aligned
+  // requests are absorbed by the `bytes + alignment` headroom.
+  auto* const memory = ::operator new(sizeof(Chunk) + payload_size);
+  auto* const chunk = new (memory) Chunk{};
+  chunk->previous = head_chunk_;
+  chunk->size = payload_size;
+  head_chunk_ = chunk;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,72 @@
+#include <userver/engine/task/task_local_arena.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(TaskLocalArena, BasicAllocation) {
+  auto& arena = engine::TaskLocalArena::OfCurrentTask();
+  EXPECT_EQ(arena.GetAllocatedBytes(), 0);
+
+  auto* ptr = arena.Allocate(1000);
+  ASSERT_NE(ptr, nullptr);
+  EXPECT_GE(arena.GetAllocatedBytes(), 1000);
+
+  // the memory is writable for the whole requested size
+  std::memset(ptr, 0xab, 1000);
+}
+
+UTEST(TaskLocalArena, AlignmentIsHonored) {
+  auto& arena = engine::TaskLocalArena::OfCurrentTask();
+
+  arena.Allocate(1);  // knock the cursor off alignment
+  for (const std::size_t alignment : {8, 16, 64, 4096}) {
+    auto* ptr = arena.Allocate(10, alignment);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0)
+        << "alignment=" << alignment;
+  }
+}
+
+UTEST(TaskLocalArena, GrowsPastInitialChunk) {
+  auto& arena = engine::TaskLocalArena::OfCurrentTask();
+
+  for (int i = 0; i < 1000; ++i) {
+    auto* ptr = arena.Allocate(1024);
+    ASSERT_NE(ptr, nullptr);
+  }
+  EXPECT_GE(arena.GetAllocatedBytes(), 1000 * 1024);
+}
+
+UTEST(TaskLocalArena, SameArenaWithinTask) {
+  auto& first = engine::TaskLocalArena::OfCurrentTask();
+  auto& second = engine::TaskLocalArena::OfCurrentTask();
+  EXPECT_EQ(&first, &second);
+}
+
+UTEST(TaskLocalArena, SeparateArenaPerTask) {
+  auto& outer = engine::TaskLocalArena::OfCurrentTask();
+  outer.Allocate(64);
+
+  engine::AsyncNoSpan([&] {
+    auto& inner = engine::TaskLocalArena::OfCurrentTask();
+    EXPECT_NE(&outer, &inner);
+    EXPECT_EQ(inner.GetAllocatedBytes(), 0);
+  }).Get();
+}
+
+#ifdef __cpp_lib_memory_resource
+UTEST(TaskLocalArena, PmrAdapter) {
+  auto& arena = engine::TaskLocalArena::OfCurrentTask();
+
+  std::pmr::vector<int> numbers{&arena.GetMemoryResource()};
+  numbers.resize(1000);
+
+  EXPECT_GE(arena.GetAllocatedBytes(), 1000 * sizeof(int));
+}
+#endif
+
+USERVER_NAMESPACE_END
@@ -282,6 +282,22 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
       break;
   }
 
+  if (!config_.cpu_affinity.empty()) {
+    try {
+      utils::SetCurrentThreadCpuAffinity(config_.cpu_affinity);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to pin worker thread of task processor " << Name()
+                  << " to the configured CPU set: " << ex;
+    }
+  } else if (config_.numa_node >= 0) {
+    try {
+      utils::SetCurrentThreadNumaNode(config_.numa_node);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to pin worker thread of task processor " << Name()
+                  << " to NUMA node " << config_.numa_node << ": " << ex;
+    }
+  }
+
   utils::SetCurrentThreadName(fmt::format("{}_{}", config_.thread_name, index));
 
   impl::SetLocalTaskCounterData(task_counter_, index);
@@ -297,6 +313,14 @@ void TaskProcessor::ProcessTasks() noexcept {
     GetTaskCounter().AccountTaskSwitchSlow();
     CheckWaitTime(*context);
 
+    // Computing the queue length is not free, sample it sparsely.
+    static constexpr std::size_t kQueueDepthSampleInterval = 64;
+    thread_local std::size_t depth_sample_count = 0;
+    if (++depth_sample_count == kQueueDepthSampleInterval) {
+      depth_sample_count = 0;
+      GetTaskCounter().AccountTaskQueueDepth(GetTaskQueueSize());
+    }
+
     bool has_failed = false;
     try {
       context->DoStep();
@@ -316,18 +340,29 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
       GetOverloadActionAndValue(action_bit_and_max_task_queue_wait_time_);
   const auto sensor_wait_time = sensor_task_queue_wait_time_.load();
 
-  if (max_wait_time.count() == 0 && sensor_wait_time.count() == 0) {
-    SetTaskQueueWaitTimeOverloaded(false);
-    return;
-  }
-
   const auto wait_timepoint = context.GetQueueWaitTimepoint();
-  if (wait_timepoint != std::chrono::steady_clock::time_point()) {
-    const auto wait_time = std::chrono::steady_clock::now() - wait_timepoint;
+  const bool has_timestamp =
+      wait_timepoint != std::chrono::steady_clock::time_point();
+
+  std::chrono::steady_clock::duration wait_time{};
+  if (has_timestamp) {
+    wait_time = std::chrono::steady_clock::now() - wait_timepoint;
     const auto wait_time_us =
         std::chrono::duration_cast<std::chrono::microseconds>(wait_time);
     LOG_TRACE() << "queue wait time = " << wait_time_us.count() << "us";
 
+    // Tasks with a timestamp are a 1-in-kTaskTimestampInterval sample, see
+    // SetTaskQueueWaitTimepoint. Recorded regardless of the overload limits
+    // so that the scheduling-latency histogram is always available.
+    GetTaskCounter().AccountTaskQueueWaitTime(wait_time_us);
+  }
+
+  if (max_wait_time.count() == 0 && sensor_wait_time.count() == 0) {
+    SetTaskQueueWaitTimeOverloaded(false);
+    return;
+  }
+
+  if (has_timestamp) {
     SetTaskQueueWaitTimeOverloaded(max_wait_time.count() &&
                                    wait_time >= max_wait_time);
 
@@ -63,6 +63,13 @@ class TaskProcessor final {
 
   std::size_t GetWorkerCount() const { return workers_.size(); }
 
+  // Whether the wait-time sensor currently considers this task processor
+  // overloaded; used for early request admission control.
+  bool IsQueueWaitTimeOverloaded() const noexcept {
+    return overloaded_cache_->overloaded_by_wait_time.load(
+        std::memory_order_relaxed);
+  }
+
   void SetSettings(const TaskProcessorSettings& settings);
 
   std::chrono::microseconds GetProfilerThreshold() const;
@@ -56,6 +56,11 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
       value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
   config.spinning_iterations =
       value["spinning-iterations"].As<int>(config.spinning_iterations);
+  config.numa_node = value["numa-node"].As<int>(config.numa_node);
+  config.cpu_affinity =
+      value["cpu-affinity"].As<std::vector<int>>(config.cpu_affinity);
+  config.adaptive_spinning =
+      value["adaptive-spinning"].As<bool>(config.adaptive_spinning);
 
   const auto task_trace = value["task-trace"];
   if (!task_trace.IsMissing()) {
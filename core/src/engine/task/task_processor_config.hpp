@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
@@ -30,6 +31,19 @@ struct TaskProcessorConfig {
   OsScheduling os_scheduling{OsScheduling::kNormal};
   int spinning_iterations{1000};
 
+  // With adaptive spinning enabled, spinning_iterations becomes the upper
+  // bound of a spin budget that grows on bursty arrivals and decays to 0 on
+  // an idle queue, see TaskQueue::WaitAdaptive.
+  bool adaptive_spinning{false};
+
+  // NUMA node to pin worker threads to, -1 disables pinning. With pinning
+  // enabled the coroutine pool keeps stacks node-local, see engine::coro::Pool.
+  int numa_node{-1};
+
+  // Explicit CPU ids to pin worker threads to; empty leaves placement to
+  // the OS (or to numa_node). Takes precedence over numa_node.
+  std::vector<int> cpu_affinity{};
+
   std::size_t task_trace_every{1000};
   std::size_t task_trace_max_csw{0};
   std::string task_trace_logger_name;
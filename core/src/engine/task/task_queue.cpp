@@ -1,5 +1,7 @@
 #include <engine/task/task_queue.hpp>
 
+#include <algorithm>
+
 #include <engine/task/task_context.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -7,11 +9,23 @@ USERVER_NAMESPACE_BEGIN
 namespace engine {
 
 namespace {
+
 constexpr std::size_t kSemaphoreInitialCount = 0;
-}
+
+// Additive increase step of the spin budget on a successful spin-grab. The
+// multiplicative decrease on parking is done in WaitAdaptive.
+constexpr int kSpinBudgetIncreaseStep = 64;
+
+}  // namespace
 
 TaskQueue::TaskQueue(const TaskProcessorConfig& config)
-    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+    : queue_semaphore_(kSemaphoreInitialCount,
+                       config.adaptive_spinning ? 0
+                                                : config.spinning_iterations),
+      max_spin_budget_(
+          config.adaptive_spinning ? std::max(config.spinning_iterations, 0)
+                                   : 0),
+      spin_budget_(0) {}
 
 void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
   UASSERT(context);
@@ -53,7 +67,11 @@ impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
 
   // This piece of code is copy-pasted from
   // moodycamel::BlockingConcurrentQueue::wait_dequeue
-  queue_semaphore_.wait();
+  if (max_spin_budget_ != 0) {
+    WaitAdaptive();
+  } else {
+    queue_semaphore_.wait();
+  }
   while (!queue_.try_dequeue(token, context)) {
     // Can happen when another consumer steals our item in exchange for another
     // item in a Moodycamel sub-queue that we have already passed.
@@ -62,6 +80,33 @@ impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
   return context;
 }
 
+void TaskQueue::WaitAdaptive() {
+  // The semaphore itself is constructed with 0 spins in this mode, so wait()
+  // parks immediately once our own spin budget is exhausted.
+  const int budget = spin_budget_.load(std::memory_order_relaxed);
+
+  for (int spin = 0; spin < budget; ++spin) {
+    if (queue_semaphore_.tryWait()) {
+      // Spinning won us a task: arrivals are frequent enough to pay for the
+      // burned cycles, allow spinning for a bit longer next time.
+      spin_budget_.store(
+          std::min(budget + kSpinBudgetIncreaseStep, max_spin_budget_),
+          std::memory_order_relaxed);
+      return;
+    }
+  }
+
+  // The budget did not pay off, halve it before parking so that an idle
+  // service converges to plain futex sleep.
+  spin_budget_.store(budget / 2, std::memory_order_relaxed);
+  queue_semaphore_.wait();
+  // A successful wakeup from park is the signal that arrivals resumed.
+  spin_budget_.store(
+      std::max(spin_budget_.load(std::memory_order_relaxed),
+               kSpinBudgetIncreaseStep),
+      std::memory_order_relaxed);
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 #include <moodycamel/blockingconcurrentqueue.h>
 #include <moodycamel/lightweightsemaphore.h>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
@@ -32,8 +34,16 @@ class TaskQueue final {
 
   impl::TaskContext* DoPopBlocking(moodycamel::ConsumerToken& token);
 
+  void WaitAdaptive();
+
   moodycamel::ConcurrentQueue<impl::TaskContext*> queue_;
   moodycamel::LightweightSemaphore queue_semaphore_;
+
+  // Adaptive spin-then-park: the budget grows while spinning keeps winning
+  // tasks (bursty arrivals) and decays to 0 once workers start parking, so an
+  // idle service does not burn CPU. 0 in max_spin_budget_ disables the mode.
+  const int max_spin_budget_;
+  std::atomic<int> spin_budget_;
 };
 
 }  // namespace engine
@@ -47,4 +47,19 @@ UTEST_MT(EngineYield, DISABLED_IsBroken, 2) {
   slow_task.Get();
 }
 
+UTEST(YieldIfSliceExceeded, NoYieldWithinBudget) {
+  // a freshly scheduled task is well within any sane budget
+  EXPECT_FALSE(engine::YieldIfSliceExceeded(std::chrono::milliseconds{1000}));
+}
+
+UTEST(YieldIfSliceExceeded, YieldsAfterBudget) {
+  const auto spin_until = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds{50};
+  bool yielded = false;
+  while (std::chrono::steady_clock::now() < spin_until && !yielded) {
+    yielded = engine::YieldIfSliceExceeded(std::chrono::milliseconds{5});
+  }
+  EXPECT_TRUE(yielded);
+}
+
 USERVER_NAMESPACE_END
@@ -1,4 +1,5 @@
 #include <userver/engine/wait_any.hpp>
+#include <userver/engine/wait_any_set.hpp>
 
 #include <engine/impl/wait_any_utils.hpp>
 #include <engine/task/task_context.hpp>
@@ -8,10 +9,10 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
-std::optional<std::size_t> DoWaitAny(utils::span<ContextAccessor*> targets,
-                                     Deadline deadline) {
-  UASSERT_MSG(AreUniqueValues(targets),
-              "Same tasks/futures were detected in WaitAny* call");
+namespace {
+
+std::optional<std::size_t> DoWaitAnyPrechecked(
+    utils::span<ContextAccessor*> targets, Deadline deadline) {
   bool none_valid = true;
 
   for (const auto& [idx, target] : utils::enumerate(targets)) {
@@ -39,6 +40,29 @@ std::optional<std::size_t> DoWaitAny(utils::span<ContextAccessor*> targets,
   return std::nullopt;
 }
 
+}  // namespace
+
+std::optional<std::size_t> DoWaitAny(utils::span<ContextAccessor*> targets,
+                                     Deadline deadline) {
+  UASSERT_MSG(AreUniqueValues(targets),
+              "Same tasks/futures were detected in WaitAny* call");
+  return DoWaitAnyPrechecked(targets, deadline);
+}
+
+void AssertWaitAnyTargetsUnique(utils::span<ContextAccessor* const> targets) {
+  UASSERT_MSG(AreUniqueValues(targets),
+              "Same tasks/futures were detected in a WaitAnySet");
+}
+
 }  // namespace engine::impl
 
+namespace engine {
+
+std::optional<std::size_t> WaitAnySet::WaitAnyUntil(Deadline deadline) {
+  // Uniqueness was verified once at construction.
+  return impl::DoWaitAnyPrechecked(targets_, deadline);
+}
+
+}  // namespace engine
+
 USERVER_NAMESPACE_END
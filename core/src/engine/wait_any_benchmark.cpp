@@ -0,0 +1,60 @@
+#include <userver/engine/wait_any.hpp>
+#include <userver/engine/wait_any_set.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/future.hpp>
+#include <userver/engine/run_standalone.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Both benchmarks model the hedged-request pattern: a loop of WaitAny calls
+// over the same handful of futures, where one of them is already ready.
+
+void wait_any_repeated(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto target_count = static_cast<std::size_t>(state.range(0));
+
+    std::vector<engine::Promise<int>> promises(target_count);
+    std::vector<engine::Future<int>> futures;
+    futures.reserve(target_count);
+    for (auto& promise : promises) {
+      futures.push_back(promise.get_future());
+    }
+    promises.front().set_value(1);
+
+    for ([[maybe_unused]] auto _ : state) {
+      const auto index = engine::WaitAny(futures);
+      benchmark::DoNotOptimize(index);
+    }
+  });
+}
+BENCHMARK(wait_any_repeated)->Arg(3)->Arg(5)->Arg(8);
+
+void wait_any_set_repeated(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto target_count = static_cast<std::size_t>(state.range(0));
+
+    std::vector<engine::Promise<int>> promises(target_count);
+    std::vector<engine::Future<int>> futures;
+    futures.reserve(target_count);
+    for (auto& promise : promises) {
+      futures.push_back(promise.get_future());
+    }
+    promises.front().set_value(1);
+
+    auto wait_set = engine::WaitAnySet::FromContainer(futures);
+
+    for ([[maybe_unused]] auto _ : state) {
+      const auto index = wait_set.WaitAny();
+      benchmark::DoNotOptimize(index);
+    }
+  });
+}
+BENCHMARK(wait_any_set_repeated)->Arg(3)->Arg(5)->Arg(8);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
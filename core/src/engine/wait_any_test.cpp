@@ -10,6 +10,7 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/wait_any.hpp>
+#include <userver/engine/wait_any_set.hpp>
 #include <userver/utils/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -164,6 +165,50 @@ UTEST(WaitAny, Sample) {
   /// [sample waitany]
 }
 
+UTEST(WaitAny, WaitAnySetSample) {
+  /// [sample waitanyset]
+  engine::Promise<int> fast_promise;
+  auto fast_future = fast_promise.get_future();
+
+  auto slow_task = utils::Async("long_task", [] {
+    engine::InterruptibleSleepFor(20s);
+    return std::string{"abc"};
+  });
+
+  // The registrations bookkeeping is set up once and reused by every wait.
+  engine::WaitAnySet wait_set{fast_future, slow_task};
+
+  fast_promise.set_value(42);
+  auto task_idx_opt = wait_set.WaitAny();
+  ASSERT_TRUE(task_idx_opt);
+  EXPECT_EQ(*task_idx_opt, 0);
+  EXPECT_EQ(fast_future.get(), 42);
+  /// [sample waitanyset]
+}
+
+UTEST(WaitAny, WaitAnySetRepeatedWaits) {
+  const std::size_t kTaskCount = 4;
+  std::vector<engine::Promise<int>> promises(kTaskCount);
+  std::vector<engine::Future<int>> futures;
+  futures.reserve(kTaskCount);
+  for (auto& promise : promises) futures.push_back(promise.get_future());
+
+  auto wait_set = engine::WaitAnySet::FromContainer(futures);
+  EXPECT_EQ(wait_set.GetSize(), kTaskCount);
+
+  for (std::size_t i = 0; i < kTaskCount; ++i) {
+    promises[i].set_value(static_cast<int>(i));
+    const auto idx = wait_set.WaitAnyFor(utest::kMaxTestWaitTime);
+    ASSERT_TRUE(idx);
+    EXPECT_EQ(*idx, i);
+    EXPECT_EQ(futures[i].get(), static_cast<int>(i));
+    wait_set.Remove(i);
+  }
+
+  // All entries are consumed and removed by now
+  EXPECT_EQ(wait_set.WaitAny(), std::nullopt);
+}
+
 UTEST(WaitAny, Throwing) {
   const size_t kTaskCount = 2;
   std::vector<engine::TaskWithResult<void>> tasks;
@@ -85,6 +85,9 @@ TpLogger::~TpLogger() {
   UASSERT_MSG(!consuming_task_.IsValid(),
               "We may be in non coroutine context, async logger must be in "
               "sync mode and consuming task must be stopped");
+
+  impl::async::ActionNode* node = nullptr;
+  while (node_pool_.try_dequeue(node)) delete node;
 }
 
 void TpLogger::StopConsumerTask() {
@@ -247,9 +250,12 @@ bool TpLogger::TryWaitFreeQueueCapacity() {
 }
 
 void TpLogger::Push(impl::async::Action&& action) {
-  auto node = std::make_unique<impl::async::ActionNode>();
+  impl::async::ActionNode* node = nullptr;
+  if (!node_pool_.try_dequeue(node)) {
+    node = new impl::async::ActionNode();
+  }
   node->action = std::move(action);
-  DoPush(*node.release());
+  DoPush(*node);
 }
 
 void TpLogger::DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
@@ -282,6 +288,14 @@ void TpLogger::ConsumeNode(
   if (&action_node == &stop_node_) return;
 
   BackendPerform(std::move(action_node.action));
+
+  // The moved-from action may still hold payload capacity, which gets
+  // reused by the next producer grabbing the node.
+  constexpr std::size_t kNodePoolMaxSize = 256;
+  if (node_pool_.size_approx() < kNodePoolMaxSize &&
+      node_pool_.enqueue(&action_node)) {
+    return;
+  }
   delete &action_node;
 }
 
@@ -9,6 +9,8 @@
 #include <variant>
 #include <vector>
 
+#include <moodycamel/concurrentqueue.h>
+
 #include <userver/engine/condition_variable.hpp>
 #include <userver/engine/future.hpp>
 #include <userver/engine/mutex.hpp>
@@ -133,6 +135,10 @@ class TpLogger final : public LoggerBase {
   Queue queue_;
   concurrent::impl::InterferenceShield<std::atomic<QueueSize>> produced_{0};
   concurrent::impl::InterferenceShield<std::atomic<QueueSize>> consumed_{0};
+
+  // Recycles consumed ActionNodes (and their payload string capacity) back
+  // to producers, removing the per-record heap allocation of Push.
+  moodycamel::ConcurrentQueue<impl::async::ActionNode*> node_pool_;
 };
 
 }  // namespace logging::impl
@@ -0,0 +1,52 @@
+#include <userver/rcu/coalescing_writer.hpp>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(RcuCoalescingWriter, FirstAssignPublishesImmediately) {
+  rcu::Variable<int> variable{0};
+  rcu::CoalescingWriter<int> writer{variable, std::chrono::seconds{10}};
+
+  writer.Assign(1);
+  EXPECT_EQ(*variable.Read(), 1);
+}
+
+UTEST(RcuCoalescingWriter, BurstCoalescesUntilFlush) {
+  rcu::Variable<int> variable{0};
+  rcu::CoalescingWriter<int> writer{variable, std::chrono::seconds{10}};
+
+  writer.Assign(1);  // publishes (window since epoch passed)
+  writer.Assign(2);  // buffered
+  writer.Assign(3);  // buffered, overwrites 2
+  EXPECT_EQ(*variable.Read(), 1);
+
+  writer.Flush();
+  EXPECT_EQ(*variable.Read(), 3);
+}
+
+UTEST(RcuCoalescingWriter, DestructorFlushes) {
+  rcu::Variable<int> variable{0};
+  {
+    rcu::CoalescingWriter<int> writer{variable, std::chrono::seconds{10}};
+    writer.Assign(1);
+    writer.Assign(7);
+  }
+  EXPECT_EQ(*variable.Read(), 7);
+}
+
+UTEST(RcuCoalescingWriter, PeriodicFlushPublishesTrailingWrite) {
+  rcu::Variable<int> variable{0};
+  rcu::CoalescingWriter<int> writer{variable, std::chrono::milliseconds{10}};
+
+  writer.Assign(1);
+  writer.Assign(2);  // buffered, published by the periodic flush
+
+  for (int i = 0; i < 100 && *variable.Read() != 2; ++i) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+  EXPECT_EQ(*variable.Read(), 2);
+}
+
+USERVER_NAMESPACE_END
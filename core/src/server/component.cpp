@@ -190,7 +190,12 @@ properties:
                         defaultDescription: 20ms
             shards:
                 type: integer
-                description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+                description: |
+                    number of listener shards, each accepting on its own
+                    SO_REUSEPORT socket so the kernel spreads incoming
+                    connections between them; defaults to the event thread
+                    pool size. Balance is observable through the
+                    connections.accepted-by-listener metric
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
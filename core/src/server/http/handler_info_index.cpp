@@ -65,7 +65,10 @@ MatchRequestResult HandlerInfoIndex::HandlerInfoIndexImpl::MatchRequest(
   if (fixed_path_index_.MatchRequest(method, path, match_result))
     return match_result;
 
-  wildcard_path_index_.MatchRequest(method, path, match_result);
+  // Skip the per-segment path split when there are no wildcard handlers
+  if (!wildcard_path_index_.IsEmpty()) {
+    wildcard_path_index_.MatchRequest(method, path, match_result);
+  }
   return match_result;
 }
 
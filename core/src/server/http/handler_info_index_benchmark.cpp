@@ -0,0 +1,35 @@
+#include <server/http/handler_info_index.hpp>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Registering real handlers requires the full component system, so this
+// benchmark measures the per-request routing overhead itself: the fixed-path
+// lookup miss plus the wildcard-index entry, which is the path taken by
+// every request that does not hit a static route.
+
+void handler_info_index_match_miss(benchmark::State& state) {
+  const server::http::HandlerInfoIndex index;
+
+  const std::string path = [&] {
+    std::string result;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      result += "/segment";
+    }
+    return result;
+  }();
+
+  for ([[maybe_unused]] auto _ : state) {
+    auto match_result =
+        index.MatchRequest(server::http::HttpMethod::kGet, path);
+    benchmark::DoNotOptimize(match_result);
+  }
+}
+BENCHMARK(handler_info_index_match_miss)->Arg(1)->Arg(4)->Arg(16);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
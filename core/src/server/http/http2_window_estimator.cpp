@@ -0,0 +1,46 @@
+#include <server/http/http2_window_estimator.hpp>
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+void Http2WindowEstimator::AccountConsumed(
+    std::size_t bytes, std::chrono::steady_clock::time_point now) noexcept {
+  if (last_consumed_at_ != std::chrono::steady_clock::time_point{}) {
+    const std::chrono::duration<double> elapsed = now - last_consumed_at_;
+    if (elapsed.count() > 0) {
+      const double rate = static_cast<double>(bytes) / elapsed.count();
+      drain_rate_bytes_per_sec_ =
+          drain_rate_bytes_per_sec_ == 0.0
+              ? rate
+              : drain_rate_bytes_per_sec_ +
+                    kSmoothing * (rate - drain_rate_bytes_per_sec_);
+    }
+  }
+  last_consumed_at_ = now;
+}
+
+void Http2WindowEstimator::AccountRtt(std::chrono::microseconds rtt) noexcept {
+  const double rtt_seconds =
+      std::chrono::duration<double>(rtt).count();
+  rtt_seconds_ = rtt_seconds_ == 0.0
+                     ? rtt_seconds
+                     : rtt_seconds_ + kSmoothing * (rtt_seconds - rtt_seconds_);
+}
+
+std::int32_t Http2WindowEstimator::GetRecommendedWindow() const noexcept {
+  if (drain_rate_bytes_per_sec_ == 0.0 || rtt_seconds_ == 0.0) {
+    return kMinWindow;
+  }
+
+  const double bdp = drain_rate_bytes_per_sec_ * rtt_seconds_ * kBdpHeadroom;
+  return std::clamp(static_cast<std::int32_t>(std::min(
+                        bdp, static_cast<double>(kMaxWindow))),
+                    kMinWindow, kMaxWindow);
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+// Computes a per-stream HTTP/2 flow-control window from the measured
+// connection RTT and the observed drain rate of the stream, aiming at
+// window ~= BDP * kBdpHeadroom so that bulk streams on high-BDP links are
+// not throttled by a static window while small streams keep small windows.
+//
+// Intended to drive nghttp2_session_set_local_window_size() once the
+// HTTP/2 server session lands; kept free of nghttp2 types so that it is
+// unit-testable in isolation.
+class Http2WindowEstimator final {
+ public:
+  // just above the 65535 initial window of RFC 9113
+  static constexpr std::int32_t kMinWindow = 64 * 1024;
+  static constexpr std::int32_t kMaxWindow = 16 * 1024 * 1024;  // sanity cap
+
+  // Records that `bytes` of the stream were consumed by the peer (WINDOW_UPDATE
+  // driven) at the given time point.
+  void AccountConsumed(std::size_t bytes,
+                       std::chrono::steady_clock::time_point now) noexcept;
+
+  // Records an RTT sample, e.g. from SETTINGS/PING acks.
+  void AccountRtt(std::chrono::microseconds rtt) noexcept;
+
+  // The recommended stream window right now: clamp(BDP * headroom).
+  std::int32_t GetRecommendedWindow() const noexcept;
+
+ private:
+  static constexpr double kBdpHeadroom = 2.0;
+  // EMA smoothing factor for both the drain rate and the RTT.
+  static constexpr double kSmoothing = 0.125;
+
+  double drain_rate_bytes_per_sec_{0.0};
+  double rtt_seconds_{0.0};
+  std::chrono::steady_clock::time_point last_consumed_at_{};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
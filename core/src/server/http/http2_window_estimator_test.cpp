@@ -0,0 +1,63 @@
+#include <server/http/http2_window_estimator.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Estimator = server::http::Http2WindowEstimator;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+}  // namespace
+
+TEST(Http2WindowEstimator, DefaultsToMinWindow) {
+  const Estimator estimator;
+  EXPECT_EQ(estimator.GetRecommendedWindow(), Estimator::kMinWindow);
+}
+
+TEST(Http2WindowEstimator, SlowStreamKeepsSmallWindow) {
+  Estimator estimator;
+  estimator.AccountRtt(microseconds{500});  // fast intra-DC link
+
+  auto now = std::chrono::steady_clock::now();
+  for (int i = 0; i < 10; ++i) {
+    // 1 KiB every 10ms ~= 100 KiB/s: BDP is tiny
+    estimator.AccountConsumed(1024, now);
+    now += milliseconds{10};
+  }
+
+  EXPECT_EQ(estimator.GetRecommendedWindow(), Estimator::kMinWindow);
+}
+
+TEST(Http2WindowEstimator, BulkStreamOnFatLinkGrowsWindow) {
+  Estimator estimator;
+  estimator.AccountRtt(milliseconds{50});  // cross-DC link
+
+  auto now = std::chrono::steady_clock::now();
+  for (int i = 0; i < 100; ++i) {
+    // 1 MiB every 10 ms ~= 100 MiB/s
+    estimator.AccountConsumed(1024 * 1024, now);
+    now += milliseconds{10};
+  }
+
+  const auto window = estimator.GetRecommendedWindow();
+  EXPECT_GT(window, Estimator::kMinWindow);
+  EXPECT_LE(window, Estimator::kMaxWindow);
+}
+
+TEST(Http2WindowEstimator, WindowIsCapped) {
+  Estimator estimator;
+  estimator.AccountRtt(std::chrono::seconds{2});  // absurdly long RTT
+
+  auto now = std::chrono::steady_clock::now();
+  for (int i = 0; i < 10; ++i) {
+    estimator.AccountConsumed(256 * 1024 * 1024, now);
+    now += milliseconds{1};
+  }
+
+  EXPECT_EQ(estimator.GetRecommendedWindow(), Estimator::kMaxWindow);
+}
+
+USERVER_NAMESPACE_END
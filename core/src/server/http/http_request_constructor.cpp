@@ -3,6 +3,7 @@
 #include <http_parser.h>
 
 #include <algorithm>
+#include <charconv>
 
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/log.hpp>
@@ -19,6 +20,23 @@ namespace server::http {
 
 namespace {
 
+// Mirrors the acceptance rules of http::parser::UrlDecode: every '%' must be
+// followed by two hex digits within the string.
+bool IsPercentEncodingValid(std::string_view str) noexcept {
+  const auto is_hex = [](char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') ||
+           (c >= 'A' && c <= 'F');
+  };
+
+  std::size_t pos = 0;
+  while ((pos = str.find('%', pos)) != std::string_view::npos) {
+    if (pos + 2 >= str.size()) return false;
+    if (!is_hex(str[pos + 1]) || !is_hex(str[pos + 2])) return false;
+    pos += 3;
+  }
+  return true;
+}
+
 inline void Strip(const char*& begin, const char*& end) {
   while (begin < end && isspace(*begin)) ++begin;
   while (begin < end && isspace(end[-1])) --end;
@@ -49,10 +67,16 @@ struct HttpRequestConstructor::HttpParserUrl {
 
 HttpRequestConstructor::HttpRequestConstructor(
     Config config, const HandlerInfoIndex& handler_info_index,
-    request::ResponseDataAccounter& data_accounter)
+    request::ResponseDataAccounter& data_accounter,
+    std::shared_ptr<impl::RequestMemoryPool> memory_pool)
     : config_(config),
       handler_info_index_(handler_info_index),
-      request_(std::make_shared<HttpRequestImpl>(data_accounter)) {}
+      request_(memory_pool
+                   ? std::allocate_shared<HttpRequestImpl>(
+                         impl::PoolAllocator<HttpRequestImpl>{
+                             std::move(memory_pool)},
+                         data_accounter)
+                   : std::make_shared<HttpRequestImpl>(data_accounter)) {}
 
 HttpRequestConstructor::~HttpRequestConstructor() = default;
 
@@ -196,11 +220,15 @@ void HttpRequestConstructor::FinalizeImpl() {
   }
 
   try {
-    ParseArgs(*parsed_url_pimpl_);
     if (config_.parse_args_from_body) {
+      // Args from URL and body share one map, keep both eager to preserve
+      // the insertion order of multi-value args.
+      ParseArgs(*parsed_url_pimpl_);
       if (!config_.decompress_request || !request_->IsBodyCompressed())
         ParseArgs(request_->request_body_.data(),
                   request_->request_body_.size());
+    } else {
+      DeferQueryArgsParsing(*parsed_url_pimpl_);
     }
   } catch (const std::exception& ex) {
     LOG_WARNING() << "can't parse args: " << ex;
@@ -235,6 +263,28 @@ void HttpRequestConstructor::FinalizeImpl() {
   }
 }
 
+void HttpRequestConstructor::DeferQueryArgsParsing(const HttpParserUrl& url) {
+  if (!(url.parsed_url.field_set & (1 << http_parser_url_fields::UF_QUERY))) {
+    return;
+  }
+  const auto& str_info =
+      url.parsed_url.field_data[http_parser_url_fields::UF_QUERY];
+  const std::string_view query{request_->url_.data() + str_info.off,
+                               str_info.len};
+
+  // A malformed query must still produce a parse-args error response, so
+  // the percent-encoding is validated now; the values are decoded into the
+  // args map on first access only.
+  if (!IsPercentEncodingValid(query)) {
+    throw std::runtime_error("invalid percent-encoding sequence in query '" +
+                             std::string{query} + '\'');
+  }
+
+  request_->query_offset_ = str_info.off;
+  request_->query_length_ = str_info.len;
+  request_->request_args_deferred_ = true;
+}
+
 void HttpRequestConstructor::ParseArgs(const HttpParserUrl& url) {
   if (url.parsed_url.field_set & (1 << http_parser_url_fields::UF_QUERY)) {
     const auto& str_info =
@@ -314,6 +364,31 @@ void HttpRequestConstructor::ParseCookies() {
   }
 }
 
+void HttpRequestConstructor::SetEarlyRejectStatus(Status status) {
+  UASSERT(status == Status::kResourceExhausted ||
+          status == Status::kDeadlineExpired);
+  SetStatus(status);
+  // The unread body would be parsed as the next message of the connection,
+  // so the connection must not be reused.
+  SetIsFinal(true);
+}
+
+bool HttpRequestConstructor::IsClientDeadlineExpired() const {
+  const auto& timeout_ms_str = request_->GetHeader(
+      USERVER_NAMESPACE::http::headers::kXYaTaxiClientTimeoutMs);
+  if (timeout_ms_str.empty()) return false;
+
+  std::uint64_t timeout_ms{};
+  const auto* const str_end = timeout_ms_str.data() + timeout_ms_str.size();
+  const auto [parse_end, errc] =
+      std::from_chars(timeout_ms_str.data(), str_end, timeout_ms);
+  if (errc != std::errc{} || parse_end != str_end) return false;
+
+  // At header-parse time the budget has just been handed to us, so only a
+  // zero budget is known-unmeetable.
+  return timeout_ms == 0;
+}
+
 void HttpRequestConstructor::SetStatus(HttpRequestConstructor::Status status) {
   status_ = status;
 }
@@ -408,6 +483,14 @@ void HttpRequestConstructor::CheckStatus() const {
           "invalid body of multipart/form-data request");
       request_->GetHttpResponse().SetReady();
       break;
+    case Status::kResourceExhausted:
+      request_->SetResponseStatus(HttpStatus::kServiceUnavailable);
+      request_->GetHttpResponse().SetReady();
+      break;
+    case Status::kDeadlineExpired:
+      request_->SetResponseStatus(HttpStatus::kGatewayTimeout);
+      request_->GetHttpResponse().SetReady();
+      break;
   }
 }
 
@@ -10,6 +10,7 @@
 
 #include "handler_info_index.hpp"
 #include "http_request_impl.hpp"
+#include "request_memory_pool.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -29,13 +30,18 @@ class HttpRequestConstructor final : public request::RequestConstructor {
     kParseArgsError,
     kParseCookiesError,
     kParseMultipartFormDataError,
+    kResourceExhausted,
+    kDeadlineExpired,
   };
 
   using Config = server::request::HttpRequestConfig;
 
-  HttpRequestConstructor(Config config,
-                         const HandlerInfoIndex& handler_info_index,
-                         request::ResponseDataAccounter& data_accounter);
+  // With a memory_pool the request object storage of finished requests of
+  // this connection is recycled instead of going back to the allocator.
+  HttpRequestConstructor(
+      Config config, const HandlerInfoIndex& handler_info_index,
+      request::ResponseDataAccounter& data_accounter,
+      std::shared_ptr<impl::RequestMemoryPool> memory_pool = nullptr);
 
   ~HttpRequestConstructor() override;
 
@@ -54,6 +60,13 @@ class HttpRequestConstructor final : public request::RequestConstructor {
 
   void SetIsFinal(bool is_final);
 
+  // Early admission control, called right after the headers are parsed:
+  // marks the request rejected and final, so the body is never read.
+  void SetEarlyRejectStatus(Status status);
+
+  // Whether the propagated client deadline cannot be met anyway.
+  bool IsClientDeadlineExpired() const;
+
   std::shared_ptr<request::RequestBase> Finalize() override;
 
  private:
@@ -63,6 +76,7 @@ class HttpRequestConstructor final : public request::RequestConstructor {
 
   void ParseArgs(const HttpParserUrl& url);
   void ParseArgs(const char* data, size_t size);
+  void DeferQueryArgsParsing(const HttpParserUrl& url);
   void AddHeader();
   void ParseCookies();
 
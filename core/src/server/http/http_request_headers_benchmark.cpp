@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include <server/http/http_request_constructor.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/http/predefined_header.hpp>
 
 #include <utils/gbench_auxilary.hpp>
@@ -51,6 +52,45 @@ void http_request_headers_get(benchmark::State& state) {
   }
 }
 
+// Registry-known headers carry a compile-time hash and a header index, so
+// the lookup is probe + index compare with no hashing and no string
+// comparison; the string_view lookup of the same names is the baseline.
+
+server::http::HttpRequest::HeadersMap MakeTypicalHeadersMap() {
+  namespace h = http::headers;
+  server::http::HttpRequest::HeadersMap map;
+  map[h::kHost] = "localhost";
+  map[h::kUserAgent] = "benchmark";
+  map[h::kContentType] = "application/json";
+  map[h::kContentLength] = "128";
+  map[h::kXYaTraceId] = "traceid";
+  map[h::kXYaSpanId] = "spanid";
+  map[h::kXYaRequestId] = "requestid";
+  map[h::kAcceptEncoding] = "gzip";
+  return map;
+}
+
+void http_request_known_headers_get_predefined(benchmark::State& state) {
+  namespace h = http::headers;
+  const auto map = MakeTypicalHeadersMap();
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(map.find(h::kXYaTraceId));
+    benchmark::DoNotOptimize(map.find(h::kContentType));
+    benchmark::DoNotOptimize(map.find(h::kAcceptEncoding));
+  }
+}
+
+void http_request_known_headers_get_string(benchmark::State& state) {
+  const auto map = MakeTypicalHeadersMap();
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(map.find(std::string_view{"X-YaTraceId"}));
+    benchmark::DoNotOptimize(map.find(std::string_view{"Content-Type"}));
+    benchmark::DoNotOptimize(map.find(std::string_view{"Accept-Encoding"}));
+  }
+}
+
 }  // namespace
 BENCHMARK(http_request_headers_insert)
     ->RangeMultiplier(2)
@@ -58,4 +98,7 @@ BENCHMARK(http_request_headers_insert)
 
 BENCHMARK(http_request_headers_get);
 
+BENCHMARK(http_request_known_headers_get_predefined);
+BENCHMARK(http_request_known_headers_get_string);
+
 USERVER_NAMESPACE_END
@@ -98,6 +98,7 @@ const std::string& HttpRequestImpl::GetHost() const {
 }
 
 const std::string& HttpRequestImpl::GetArg(std::string_view arg_name) const {
+  EnsureRequestArgsParsed();
   const auto* ptr =
       utils::impl::FindTransparentOrNullptr(request_args_, arg_name);
   if (!ptr) return kEmptyString;
@@ -106,6 +107,7 @@ const std::string& HttpRequestImpl::GetArg(std::string_view arg_name) const {
 
 const std::vector<std::string>& HttpRequestImpl::GetArgVector(
     std::string_view arg_name) const {
+  EnsureRequestArgsParsed();
   const auto* ptr =
       utils::impl::FindTransparentOrNullptr(request_args_, arg_name);
   if (!ptr) return kEmptyVector;
@@ -113,14 +115,19 @@ const std::vector<std::string>& HttpRequestImpl::GetArgVector(
 }
 
 bool HttpRequestImpl::HasArg(std::string_view arg_name) const {
+  EnsureRequestArgsParsed();
   const auto* ptr =
       utils::impl::FindTransparentOrNullptr(request_args_, arg_name);
   return !!ptr;
 }
 
-size_t HttpRequestImpl::ArgCount() const { return request_args_.size(); }
+size_t HttpRequestImpl::ArgCount() const {
+  EnsureRequestArgsParsed();
+  return request_args_.size();
+}
 
 std::vector<std::string> HttpRequestImpl::ArgNames() const {
+  EnsureRequestArgsParsed();
   std::vector<std::string> res;
   res.reserve(request_args_.size());
   for (const auto& arg : request_args_) res.push_back(arg.first);
@@ -257,6 +264,19 @@ void HttpRequestImpl::SetRequestBody(std::string body) {
   request_body_ = std::move(body);
 }
 
+void HttpRequestImpl::EnsureRequestArgsParsed() const {
+  std::call_once(request_args_once_, [this] {
+    if (!request_args_deferred_) return;
+    // The percent-encoding was validated by HttpRequestConstructor, decoding
+    // cannot throw here.
+    USERVER_NAMESPACE::http::parser::ParseAndConsumeArgs(
+        std::string_view{url_}.substr(query_offset_, query_length_),
+        [this](std::string&& key, std::string&& value) {
+          request_args_[std::move(key)].push_back(std::move(value));
+        });
+  });
+}
+
 void HttpRequestImpl::ParseArgsFromBody() {
   UASSERT_MSG(
       request_args_.empty(),
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -139,6 +140,8 @@ class HttpRequestImpl final : public request::RequestBase {
   friend class HttpRequestConstructor;
 
  private:
+  void EnsureRequestArgsParsed() const;
+
   HttpMethod method_{HttpMethod::kUnknown};
   unsigned short http_major_{1};
   unsigned short http_minor_{1};
@@ -146,9 +149,17 @@ class HttpRequestImpl final : public request::RequestBase {
   std::string request_path_;
   std::string request_body_;
   std::string path_suffix_;
-  utils::impl::TransparentMap<std::string, std::vector<std::string>,
-                              utils::StrCaseHash>
+  // Lazily filled from the query slice of url_ on first access, so handlers
+  // that never read query args skip the decoding and the map entirely.
+  mutable utils::impl::TransparentMap<std::string, std::vector<std::string>,
+                                      utils::StrCaseHash>
       request_args_;
+  // call_once: in-flight requests are inspectable from other tasks, see
+  // handlers::InspectRequests
+  std::size_t query_offset_{0};
+  std::size_t query_length_{0};
+  bool request_args_deferred_{false};
+  mutable std::once_flag request_args_once_;
   utils::impl::TransparentMap<std::string, std::vector<FormDataArg>,
                               utils::StrCaseHash>
       form_data_args_;
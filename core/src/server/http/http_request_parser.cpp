@@ -1,5 +1,11 @@
 #include "http_request_parser.hpp"
 
+#include <array>
+#include <string_view>
+
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/task/task_base.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/request/request_base.hpp>
@@ -34,6 +40,151 @@ HttpMethod ConvertHttpMethod(llhttp_method method) {
   }
 }
 
+// --- The scanning part of the no-state-machine fast path ---
+//
+// The scan is pure: it either validates one complete simple message or
+// reports "not applicable", in which case the bytes go to llhttp untouched.
+// Anything unusual (bodies, upgrades, folded headers, partial messages)
+// deliberately falls back, so the fast path can never disagree with llhttp
+// about a parse, only skip it.
+
+struct FastHeader final {
+  std::string_view name;
+  std::string_view value;
+};
+
+struct FastRequest final {
+  HttpMethod method{HttpMethod::kUnknown};
+  std::string_view url;
+  int http_minor{1};
+  bool keep_alive{true};
+
+  static constexpr std::size_t kMaxHeaders = 64;
+  std::array<FastHeader, kMaxHeaders> headers{};
+  std::size_t header_count{0};
+};
+
+constexpr std::array<bool, 256> MakeTokenCharTable() {
+  std::array<bool, 256> table{};
+  for (unsigned char c = '0'; c <= '9'; ++c) table[c] = true;
+  for (unsigned char c = 'a'; c <= 'z'; ++c) table[c] = true;
+  for (unsigned char c = 'A'; c <= 'Z'; ++c) table[c] = true;
+  for (const char c : {'!', '#', '$', '%', '&', '\'', '*', '+', '-', '.', '^',
+                       '_', '`', '|', '~'}) {
+    table[static_cast<unsigned char>(c)] = true;
+  }
+  return table;
+}
+
+constexpr std::array<bool, 256> kIsTokenChar = MakeTokenCharTable();
+
+char ToLowerAscii(char c) noexcept {
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+bool IcaseEquals(std::string_view lhs, std::string_view rhs) noexcept {
+  if (lhs.size() != rhs.size()) return false;
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    if (ToLowerAscii(lhs[i]) != ToLowerAscii(rhs[i])) return false;
+  }
+  return true;
+}
+
+// Returns the message length on success, 0 when the fast path does not apply.
+std::size_t ScanFastRequest(const char* data, std::size_t size,
+                            FastRequest& request) {
+  const std::string_view buffer{data, size};
+
+  std::size_t pos = 0;
+  if (buffer.substr(0, 4) == "GET ") {
+    request.method = HttpMethod::kGet;
+    pos = 4;
+  } else if (buffer.substr(0, 5) == "HEAD ") {
+    request.method = HttpMethod::kHead;
+    pos = 5;
+  } else if (buffer.substr(0, 7) == "DELETE ") {
+    request.method = HttpMethod::kDelete;
+    pos = 7;
+  } else if (buffer.substr(0, 8) == "OPTIONS ") {
+    request.method = HttpMethod::kOptions;
+    pos = 8;
+  } else {
+    return 0;
+  }
+
+  const auto url_end = buffer.find(' ', pos);
+  if (url_end == std::string_view::npos || url_end == pos) return 0;
+  request.url = buffer.substr(pos, url_end - pos);
+  for (const char c : request.url) {
+    if (static_cast<unsigned char>(c) <= 0x20 || c == 0x7f) return 0;
+  }
+
+  constexpr std::string_view kHttp11{"HTTP/1.1\r\n"};
+  constexpr std::string_view kHttp10{"HTTP/1.0\r\n"};
+  const auto version = buffer.substr(url_end + 1, kHttp11.size());
+  if (version == kHttp11) {
+    request.http_minor = 1;
+  } else if (version == kHttp10) {
+    request.http_minor = 0;
+  } else {
+    return 0;
+  }
+  request.keep_alive = request.http_minor == 1;
+  pos = url_end + 1 + kHttp11.size();
+
+  while (true) {
+    if (pos + 1 >= size) return 0;  // incomplete head
+    if (buffer[pos] == '\r') {
+      if (buffer[pos + 1] != '\n') return 0;
+      return pos + 2;
+    }
+
+    const auto colon = buffer.find(':', pos);
+    if (colon == std::string_view::npos || colon == pos) return 0;
+    const auto name = buffer.substr(pos, colon - pos);
+    for (const char c : name) {
+      if (!kIsTokenChar[static_cast<unsigned char>(c)]) return 0;
+    }
+
+    auto value_begin = colon + 1;
+    while (value_begin < size &&
+           (buffer[value_begin] == ' ' || buffer[value_begin] == '\t')) {
+      ++value_begin;
+    }
+    const auto cr = buffer.find('\r', value_begin);
+    if (cr == std::string_view::npos || cr + 1 >= size ||
+        buffer[cr + 1] != '\n') {
+      return 0;
+    }
+    auto value = buffer.substr(value_begin, cr - value_begin);
+    while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) {
+      value.remove_suffix(1);
+    }
+    if (value.find('\n') != std::string_view::npos ||
+        value.find('\0') != std::string_view::npos) {
+      return 0;
+    }
+
+    // Bodies and protocol switches go through llhttp
+    if (IcaseEquals(name, "content-length") ||
+        IcaseEquals(name, "transfer-encoding") || IcaseEquals(name, "upgrade"))
+      return 0;
+    if (IcaseEquals(name, "connection")) {
+      if (IcaseEquals(value, "close")) {
+        request.keep_alive = false;
+      } else if (IcaseEquals(value, "keep-alive")) {
+        request.keep_alive = true;
+      } else {
+        return 0;
+      }
+    }
+
+    if (request.header_count == FastRequest::kMaxHeaders) return 0;
+    request.headers[request.header_count++] = FastHeader{name, value};
+    pos = cr + 2;
+  }
+}
+
 }  // namespace
 
 const llhttp_settings_t HttpRequestParser::parser_settings = []() {
@@ -64,6 +215,16 @@ HttpRequestParser::HttpRequestParser(
 }
 
 bool HttpRequestParser::Parse(const char* data, size_t size) {
+  while (llhttp_idle_ && size != 0) {
+    const auto consumed = TryParseFast(data, size);
+    if (consumed == kFastParseError) return false;
+    if (consumed == 0) break;
+    data += consumed;
+    size -= consumed;
+  }
+  if (size == 0) return true;
+  llhttp_idle_ = false;
+
   const auto err = llhttp_execute(&parser_, data, size);
   if (err != HPE_OK) {
     const auto parsed =
@@ -182,9 +343,34 @@ int HttpRequestParser::OnHeadersCompleteImpl(llhttp_t* p) {
     return -1;
   }
   LOG_TRACE() << "headers complete";
+
+  // Early admission control: when this task processor is overloaded or the
+  // propagated client deadline cannot be met, respond right now and tell
+  // llhttp to skip the body entirely (returning 1). The request is marked
+  // final, so the unread body bytes die with the connection.
+  if (ApplyEarlyAdmission()) return 1;
   return 0;
 }
 
+bool HttpRequestParser::ApplyEarlyAdmission() {
+  UASSERT(request_constructor_);
+  if (!engine::current_task::IsTaskProcessorThread()) return false;
+
+  auto& task_processor =
+      engine::current_task::GetCurrentTaskContext().GetTaskProcessor();
+  if (task_processor.IsQueueWaitTimeOverloaded()) {
+    request_constructor_->SetEarlyRejectStatus(
+        HttpRequestConstructor::Status::kResourceExhausted);
+    return true;
+  }
+  if (request_constructor_->IsClientDeadlineExpired()) {
+    request_constructor_->SetEarlyRejectStatus(
+        HttpRequestConstructor::Status::kDeadlineExpired);
+    return true;
+  }
+  return false;
+}
+
 int HttpRequestParser::OnBodyImpl(llhttp_t* p, const char* data, size_t size) {
   UASSERT(request_constructor_);
   if (!CheckUrlComplete(p)) return -1;
@@ -213,7 +399,7 @@ int HttpRequestParser::OnMessageCompleteImpl(llhttp_t* p) {
 void HttpRequestParser::CreateRequestConstructor() {
   stats_.parsing_request_count.Add(1);
   request_constructor_.emplace(request_constructor_config_, handler_info_index_,
-                               data_accounter_);
+                               data_accounter_, request_memory_pool_);
   url_complete_ = false;
 }
 
@@ -233,6 +419,48 @@ bool HttpRequestParser::CheckUrlComplete(llhttp_t* p) {
   return true;
 }
 
+std::size_t HttpRequestParser::TryParseFast(const char* data,
+                                            std::size_t size) {
+  FastRequest fast_request;
+  const auto consumed = ScanFastRequest(data, size, fast_request);
+  if (consumed == 0) return 0;
+
+  try {
+    CreateRequestConstructor();
+    auto& constructor = *request_constructor_;
+
+    // The same sequence the llhttp callbacks produce for a body-less message
+    constructor.SetMethod(fast_request.method);
+    constructor.AppendUrl(fast_request.url.data(), fast_request.url.size());
+
+    url_complete_ = true;
+    constructor.SetHttpMajor(1);
+    constructor.SetHttpMinor(fast_request.http_minor);
+    constructor.ParseUrl();
+
+    for (std::size_t i = 0; i < fast_request.header_count; ++i) {
+      const auto& header = fast_request.headers[i];
+      constructor.AppendHeaderField(header.name.data(), header.name.size());
+      constructor.AppendHeaderValue(header.value.data(), header.value.size());
+    }
+    constructor.AppendHeaderField("", 0);
+
+    // The fast path serves exactly the requests the overload gate exists
+    // for; run the same admission control as the llhttp path (the reject
+    // marks the request final itself).
+    if (!ApplyEarlyAdmission()) {
+      constructor.SetIsFinal(!fast_request.keep_alive);
+    }
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't parse request: " << ex;
+    FinalizeRequest();
+    return kFastParseError;
+  }
+
+  if (!FinalizeRequest()) return kFastParseError;
+  return consumed;
+}
+
 bool HttpRequestParser::FinalizeRequest() {
   bool res = FinalizeRequestImpl();
   stats_.parsing_request_count.Subtract(1);
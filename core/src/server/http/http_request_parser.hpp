@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <optional>
 
@@ -54,6 +55,20 @@ class HttpRequestParser final : public request::RequestParser {
 
   bool CheckUrlComplete(llhttp_t* p);
 
+  // Attempts to parse one complete simple request (no body, no upgrade) with
+  // a memchr-driven scan instead of the llhttp state machine. Returns the
+  // number of bytes consumed, 0 if the fast path does not apply (feed the
+  // data to llhttp), or kFastParseError on a malformed message.
+  std::size_t TryParseFast(const char* data, std::size_t size);
+
+  // Early admission control shared by both parsing paths: marks the request
+  // rejected (503 on overload, 504 on an unmeetable propagated deadline) and
+  // returns whether it did.
+  bool ApplyEarlyAdmission();
+
+  static constexpr std::size_t kFastParseError =
+      std::numeric_limits<std::size_t>::max();
+
   bool FinalizeRequest();
   bool FinalizeRequestImpl();
 
@@ -62,10 +77,18 @@ class HttpRequestParser final : public request::RequestParser {
 
   bool url_complete_ = false;
 
+  // The fast path may only run while llhttp holds no partial-message state;
+  // once any bytes go through llhttp this stays false for the connection.
+  bool llhttp_idle_ = true;
+
   OnNewRequestCb on_new_request_cb_;
 
   llhttp_t parser_{};
   std::optional<HttpRequestConstructor> request_constructor_;
+  // The parser is per-connection, so this recycles request objects of the
+  // keep-alive request chain.
+  std::shared_ptr<impl::RequestMemoryPool> request_memory_pool_{
+      std::make_shared<impl::RequestMemoryPool>()};
 
   static const llhttp_settings_t parser_settings;
   net::ParserStats& stats_;
@@ -286,6 +286,134 @@ UTEST(HttpRequestParserParser, AbsentCRLF) {
   EXPECT_EQ(parsed, false);
 }
 
+UTEST(HttpRequestParserParser, PipelinedFastPath) {
+  // Two complete simple requests in one buffer go through the fast path
+  constexpr std::string_view kPipelined =
+      "GET /first HTTP/1.1\r\nHost: localhost\r\n\r\n"
+      "GET /second HTTP/1.1\r\nHost: localhost\r\n\r\n";
+
+  std::vector<std::string> urls;
+  auto parser = server::CreateTestParser(
+      [&urls](std::shared_ptr<server::request::RequestBase>&& request) {
+        auto& http_request_impl =
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+            static_cast<server::http::HttpRequestImpl&>(*request);
+        urls.push_back(http_request_impl.GetUrl());
+      });
+
+  EXPECT_TRUE(parser.Parse(kPipelined.data(), kPipelined.size()));
+  ASSERT_EQ(urls.size(), 2);
+  EXPECT_EQ(urls[0], "/first");
+  EXPECT_EQ(urls[1], "/second");
+}
+
+UTEST(HttpRequestParserParser, FragmentedFallsBackToLlhttp) {
+  // A head split between two recv buffers must still parse (via llhttp)
+  constexpr std::string_view kPart1 = "GET /fragmented HT";
+  constexpr std::string_view kPart2 = "TP/1.1\r\nHost: localhost\r\n\r\n";
+
+  bool parsed = false;
+  auto parser = server::CreateTestParser(
+      [&parsed](std::shared_ptr<server::request::RequestBase>&& request) {
+        parsed = true;
+        auto& http_request_impl =
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+            static_cast<server::http::HttpRequestImpl&>(*request);
+        EXPECT_EQ(http_request_impl.GetUrl(), "/fragmented");
+      });
+
+  EXPECT_TRUE(parser.Parse(kPart1.data(), kPart1.size()));
+  EXPECT_FALSE(parsed);
+  EXPECT_TRUE(parser.Parse(kPart2.data(), kPart2.size()));
+  EXPECT_TRUE(parsed);
+}
+
+UTEST(HttpRequestParserParser, ConnectionCloseFastPath) {
+  constexpr std::string_view kRequest =
+      "GET / HTTP/1.1\r\nConnection: close\r\n\r\n";
+
+  bool parsed = false;
+  auto parser = server::CreateTestParser(
+      [&parsed](std::shared_ptr<server::request::RequestBase>&& request) {
+        parsed = true;
+        EXPECT_TRUE(request->IsFinal());
+      });
+
+  EXPECT_TRUE(parser.Parse(kRequest.data(), kRequest.size()));
+  EXPECT_TRUE(parsed);
+}
+
+UTEST(HttpRequestParserParser, DeadlineExpiredFastPath) {
+  // body-less GET goes through the fast path and must hit the 504 gate
+  constexpr std::string_view kRequest =
+      "GET / HTTP/1.1\r\n"
+      "Host: localhost\r\nX-YaTaxi-Client-TimeoutMs: 0\r\n\r\n";
+
+  bool parsed = false;
+  auto parser = server::CreateTestParser(
+      [&parsed](std::shared_ptr<server::request::RequestBase>&& request) {
+        parsed = true;
+        auto& http_request_impl =
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+            static_cast<server::http::HttpRequestImpl&>(*request);
+        EXPECT_EQ(http_request_impl.GetHttpResponse().GetStatus(),
+                  server::http::HttpStatus::kGatewayTimeout);
+        EXPECT_TRUE(request->IsFinal());
+      });
+
+  EXPECT_TRUE(parser.Parse(kRequest.data(), kRequest.size()));
+  EXPECT_TRUE(parsed);
+}
+
+UTEST(HttpRequestParserParser, DeadlineExpiredSkipsBody) {
+  // bodied request takes the llhttp path: 504 at headers, body skipped, so
+  // the unread body bytes poison the connection (request marked final)
+  constexpr std::string_view kRequest =
+      "POST / HTTP/1.1\r\n"
+      "Host: localhost\r\nX-YaTaxi-Client-TimeoutMs: 0\r\n"
+      "Content-Length: 4\r\n\r\n"
+      "body";
+
+  bool parsed = false;
+  auto parser = server::CreateTestParser(
+      [&parsed](std::shared_ptr<server::request::RequestBase>&& request) {
+        if (parsed) return;  // trailing garbage may produce an extra request
+        parsed = true;
+        auto& http_request_impl =
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+            static_cast<server::http::HttpRequestImpl&>(*request);
+        EXPECT_EQ(http_request_impl.GetHttpResponse().GetStatus(),
+                  server::http::HttpStatus::kGatewayTimeout);
+        EXPECT_TRUE(request->IsFinal());
+      });
+
+  // the skipped body is parsed as a next message and fails, stopping the
+  // connection - which is the point of marking the request final
+  EXPECT_FALSE(parser.Parse(kRequest.data(), kRequest.size()));
+  EXPECT_TRUE(parsed);
+}
+
+UTEST(HttpRequestParserParser, UnexpiredDeadlineIsAdmitted) {
+  constexpr std::string_view kRequest =
+      "GET / HTTP/1.1\r\n"
+      "Host: localhost\r\nX-YaTaxi-Client-TimeoutMs: 10000\r\n\r\n";
+
+  bool parsed = false;
+  auto parser = server::CreateTestParser(
+      [&parsed](std::shared_ptr<server::request::RequestBase>&& request) {
+        parsed = true;
+        auto& http_request_impl =
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+            static_cast<server::http::HttpRequestImpl&>(*request);
+        EXPECT_NE(http_request_impl.GetHttpResponse().GetStatus(),
+                  server::http::HttpStatus::kGatewayTimeout);
+        EXPECT_FALSE(request->IsFinal());
+      });
+
+  EXPECT_TRUE(parser.Parse(kRequest.data(), kRequest.size()));
+  EXPECT_TRUE(parsed);
+}
+
 UTEST(HttpRequestParserParser, BodyContentLengthTooLong) {
   bool parsed = false;
   auto parser = server::CreateTestParser(
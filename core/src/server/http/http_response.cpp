@@ -142,6 +142,12 @@ void HttpResponse::SetSendFailed(
   request::ResponseBase::SetSendFailed(failure_time);
 }
 
+void HttpResponse::MarkBufferedSendFailed(
+    std::chrono::steady_clock::time_point failure_time) {
+  SetStatus(HttpStatus::kClientClosedRequest);
+  request::ResponseBase::MarkBufferedSendFailed(failure_time);
+}
+
 bool HttpResponse::SetHeader(std::string name, std::string value) {
   if (headers_end_.IsReady()) {
     // Attempt to set headers for Stream'ed response after it is already set
@@ -290,11 +290,17 @@ size_t FindBoundaryEnd(std::string_view body, std::string_view boundary,
   return std::string_view::npos;
 }
 
+// Part sink of the parsing core; `charset` is the default charset collected
+// so far.
+using InternalPartConsumer = utils::function_ref<void(
+    const std::string& name, FormDataArg&& arg,
+    const std::optional<std::string>& charset)>;
+
 bool ParseMultipartFormDataValue(std::string_view& body,
                                  std::string_view boundary,
                                  FormDataArgInfo&& arg_info,
                                  std::optional<std::string>& charset,
-                                 FormDataArgs& form_data_args,
+                                 InternalPartConsumer consumer,
                                  std::string_view crlf) {
   static const std::string kCharset = "_charset_";
 
@@ -314,7 +320,7 @@ bool ParseMultipartFormDataValue(std::string_view& body,
   } else {
     LOG_TRACE() << "add arg_info.name=" << arg_info.name
                 << ", arg_info.arg=" << arg_info.arg.ToDebugString();
-    form_data_args[arg_info.name].push_back(std::move(arg_info.arg));
+    consumer(arg_info.name, std::move(arg_info.arg), charset);
   }
   body.remove_prefix(pos);
   SkipOptionalSpaces(body);
@@ -324,8 +330,9 @@ bool ParseMultipartFormDataValue(std::string_view& body,
 bool ParseMultipartFormDataBody(std::string_view body,
                                 std::string_view boundary,
                                 std::string default_charset,
-                                FormDataArgs& form_data_args,
-                                bool strict_cr_lf) {
+                                InternalPartConsumer consumer,
+                                bool strict_cr_lf,
+                                std::optional<std::string>* final_charset) {
   LOG_TRACE() << "body=" << body << ", body.size()=" << body.size();
   std::string_view crlf = "\r\n";
   if (boundary.size() + 2 <= body.size() && body[0] == '-' && body[1] == '-' &&
@@ -362,16 +369,7 @@ bool ParseMultipartFormDataBody(std::string_view body,
         LOG_INFO() << "Extra (" << body.size()
                    << ") characters in request body";
       }
-      for (auto& [name, args] : form_data_args) {
-        UASSERT(!args.empty());
-        for (auto& arg : args) {
-          if (charset) {
-            arg.default_charset = charset;
-          }
-          LOG_TRACE() << "form_data arg, name: " << name
-                      << ", arg: " << arg.ToDebugString();
-        }
-      }
+      if (final_charset) *final_charset = std::move(charset);
       return true;
     }
     if (!SkipCrLf(body, crlf)) return false;
@@ -382,7 +380,7 @@ bool ParseMultipartFormDataBody(std::string_view body,
     LOG_TRACE() << "ParseMultipartFormDataHeaders finished, body=" << body
                 << ", body.size()=" << body.size();
     if (!ParseMultipartFormDataValue(body, boundary, std::move(arg_info),
-                                     charset, form_data_args, crlf)) {
+                                     charset, consumer, crlf)) {
       return false;
     }
   }
@@ -406,9 +404,12 @@ bool IsMultipartFormDataContentType(std::string_view content_type) {
   return false;
 }
 
-bool ParseMultipartFormData(const std::string& content_type,
-                            std::string_view body, FormDataArgs& form_data_args,
-                            bool strict_cr_lf) {
+namespace {
+
+bool DoParseMultipartFormData(const std::string& content_type,
+                              std::string_view body,
+                              InternalPartConsumer consumer, bool strict_cr_lf,
+                              std::optional<std::string>* final_charset) {
   static const std::string kBoundary = "boundary";
   static const std::string kCharset = "charset";
   static const std::string kBoundaryNotFound =
@@ -457,7 +458,52 @@ bool ParseMultipartFormData(const std::string& content_type,
   }
 
   return ParseMultipartFormDataBody(body, boundary, std::move(charset),
-                                    form_data_args, strict_cr_lf);
+                                    consumer, strict_cr_lf, final_charset);
+}
+
+}  // namespace
+
+bool ParseMultipartFormData(const std::string& content_type,
+                            std::string_view body, FormDataArgs& form_data_args,
+                            bool strict_cr_lf) {
+  std::optional<std::string> final_charset;
+  const bool parsed = DoParseMultipartFormData(
+      content_type, body,
+      [&form_data_args](const std::string& name, FormDataArg&& arg,
+                        const std::optional<std::string>&) {
+        form_data_args[name].push_back(std::move(arg));
+      },
+      strict_cr_lf, &final_charset);
+  if (!parsed) return false;
+
+  // The _charset_ part may appear anywhere in the body, apply it to
+  // everything collected.
+  for (auto& [name, args] : form_data_args) {
+    UASSERT(!args.empty());
+    for (auto& arg : args) {
+      if (final_charset) {
+        arg.default_charset = final_charset;
+      }
+      LOG_TRACE() << "form_data arg, name: " << name
+                  << ", arg: " << arg.ToDebugString();
+    }
+  }
+  return true;
+}
+
+bool ParseMultipartFormData(
+    const std::string& content_type, std::string_view body,
+    utils::function_ref<void(const std::string& name, FormDataArg&& arg)>
+        consumer,
+    bool strict_cr_lf) {
+  return DoParseMultipartFormData(
+      content_type, body,
+      [&consumer](const std::string& name, FormDataArg&& arg,
+                  const std::optional<std::string>& charset) {
+        if (charset) arg.default_charset = charset;
+        consumer(name, std::move(arg));
+      },
+      strict_cr_lf, nullptr);
 }
 
 }  // namespace server::http
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include <userver/server/http/form_data_arg.hpp>
+#include <userver/utils/function_ref.hpp>
 #include <userver/utils/impl/transparent_hash.hpp>
 #include <userver/utils/str_icase.hpp>
 
@@ -22,6 +23,17 @@ bool ParseMultipartFormData(const std::string& content_type,
                             std::string_view body, FormDataArgs& form_data_args,
                             bool strict_cr_lf = false);
 
+/// Streaming variant: parts are delivered to `consumer` in body order as
+/// zero-copy views into `body`, without building the args map, so handlers
+/// can process large uploads part-by-part with O(1) extra memory. Unlike the
+/// map-building overload, a `_charset_` part only affects the
+/// default_charset of the parts that follow it.
+bool ParseMultipartFormData(
+    const std::string& content_type, std::string_view body,
+    utils::function_ref<void(const std::string& name, FormDataArg&& arg)>
+        consumer,
+    bool strict_cr_lf = false);
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
@@ -532,4 +532,53 @@ TEST(MultipartFormDataParser, ParseErrors) {
   EXPECT_TRUE(form_data_args.empty());
 }
 
+TEST(MultipartFormDataParser, StreamingConsumer) {
+  namespace sh = server::http;
+  const std::string kContentType =
+      "multipart/form-data; boundary=------------------------8099aaf9723cd601";
+  const std::string kBody =
+      "--------------------------8099aaf9723cd601\r\n"
+      "Content-Disposition: form-data; name=\"text\"\r\n"
+      "\r\n"
+      "default\r\n"
+      "--------------------------8099aaf9723cd601\r\n"
+      "Content-Disposition: form-data; name=\"file1\"; filename=\"a.html\"\r\n"
+      "Content-Type: text/html\r\n"
+      "\r\n"
+      "<!DOCTYPE html><title>Content of a.html.</title>\n\r\n"
+      "--------------------------8099aaf9723cd601--\r\n";
+
+  std::vector<std::string> names;
+  std::vector<std::string> values;
+  ASSERT_TRUE(ParseMultipartFormData(
+      kContentType, kBody,
+      [&](const std::string& name, sh::FormDataArg&& arg) {
+        names.push_back(name);
+        values.emplace_back(arg.value);
+      }));
+
+  // parts are delivered in body order, no map is built
+  ASSERT_EQ(names.size(), 2);
+  EXPECT_EQ(names[0], "text");
+  EXPECT_EQ(values[0], "default");
+  EXPECT_EQ(names[1], "file1");
+  EXPECT_EQ(values[1], "<!DOCTYPE html><title>Content of a.html.</title>\n");
+}
+
+TEST(MultipartFormDataParser, StreamingConsumerBadBody) {
+  namespace sh = server::http;
+  const std::string kContentType = "multipart/form-data; boundary=xyz";
+  const std::string kTruncated =
+      "--xyz\r\n"
+      "Content-Disposition: form-data; name=\"text\"\r\n"
+      "\r\n"
+      "no closing boundary";
+
+  bool called = false;
+  ASSERT_FALSE(ParseMultipartFormData(
+      kContentType, kTruncated,
+      [&](const std::string&, sh::FormDataArg&&) { called = true; }));
+  EXPECT_FALSE(called);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+// A per-connection freelist for the control-block + object allocations of
+// HttpRequestImpl, so keep-alive connections stop hitting the allocator for
+// every request. The last reference to a request may be dropped on any task
+// processor thread, and deallocation may happen after the connection is
+// gone, so the pool is thread-safe and is kept alive via shared_ptr by the
+// allocators of in-flight requests.
+class RequestMemoryPool final {
+ public:
+  static constexpr std::size_t kMaxRetainedBlocks = 4;
+
+  RequestMemoryPool() { free_blocks_.reserve(kMaxRetainedBlocks); }
+
+  RequestMemoryPool(const RequestMemoryPool&) = delete;
+  RequestMemoryPool& operator=(const RequestMemoryPool&) = delete;
+
+  ~RequestMemoryPool() {
+    for (auto* block : free_blocks_) ::operator delete(block);
+  }
+
+  void* Allocate(std::size_t size) {
+    {
+      const std::lock_guard lock(mutex_);
+      if (!free_blocks_.empty() && size == block_size_) {
+        auto* const block = free_blocks_.back();
+        free_blocks_.pop_back();
+        return block;
+      }
+    }
+    return ::operator new(size);
+  }
+
+  void Release(void* block, std::size_t size) noexcept {
+    {
+      const std::lock_guard lock(mutex_);
+      if (block_size_ == 0) block_size_ = size;
+      if (size == block_size_ &&
+          free_blocks_.size() < kMaxRetainedBlocks) {
+        // cannot throw: capacity is reserved up-front
+        free_blocks_.push_back(block);
+        return;
+      }
+    }
+    ::operator delete(block);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::size_t block_size_{0};
+  std::vector<void*> free_blocks_;
+};
+
+template <typename T>
+class PoolAllocator final {
+ public:
+  using value_type = T;
+
+  explicit PoolAllocator(std::shared_ptr<RequestMemoryPool> pool) noexcept
+      : pool_(std::move(pool)) {}
+
+  template <typename U>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  PoolAllocator(const PoolAllocator<U>& other) noexcept : pool_(other.pool_) {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(pool_->Allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t n) noexcept {
+    pool_->Release(ptr, n * sizeof(T));
+  }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U>& other) const noexcept {
+    return pool_ == other.pool_;
+  }
+
+  template <typename U>
+  bool operator!=(const PoolAllocator<U>& other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  template <typename U>
+  friend class PoolAllocator;
+
+  std::shared_ptr<RequestMemoryPool> pool_;
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
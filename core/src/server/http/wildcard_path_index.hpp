@@ -2,6 +2,7 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
@@ -21,8 +22,9 @@ bool HasWildcardSpecificSymbols(const std::string& path);
 class WildcardPathIndex final {
  public:
   struct Node {
-    // ordered by position in path
-    std::map<size_t, std::map<std::string, Node>> next;
+    // ordered by position in path; transparent comparator allows lookups by
+    // string_view slices of the request path without allocations
+    std::map<size_t, std::map<std::string, Node, std::less<>>> next;
 
     // by path length
     std::map<size_t, HandlerMethodIndex> handler_method_index_map;
@@ -34,6 +36,11 @@ class WildcardPathIndex final {
   bool MatchRequest(HttpMethod method, const std::string& path,
                     MatchRequestResult& match_result) const;
 
+  // An empty index cannot match anything, the split can be skipped entirely.
+  bool IsEmpty() const noexcept {
+    return root_.next.empty() && root_.handler_method_index_map.empty();
+  }
+
  private:
   void AddHandler(const std::string& path,
                   const handlers::HttpHandlerBase& handler,
@@ -45,7 +52,7 @@ class WildcardPathIndex final {
                std::vector<PathItem> wildcards);
 
   bool MatchRequest(const Node& node, HttpMethod method,
-                    const std::vector<std::string>& path,
+                    const std::vector<std::string_view>& path,
                     size_t path_string_length,
                     MatchRequestResult& match_result) const;
 
@@ -0,0 +1,194 @@
+#include <server/middlewares/compression.hpp>
+
+#include <optional>
+
+#include <compression/gzip.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/tracing/scope_time.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace {
+
+constexpr std::size_t kDefaultMinResponseSize = 1024;
+constexpr int kDefaultLevel = 6;
+
+std::string_view TrimSpaces(std::string_view str) noexcept {
+  while (!str.empty() && str.front() == ' ') str.remove_prefix(1);
+  while (!str.empty() && str.back() == ' ') str.remove_suffix(1);
+  return str;
+}
+
+}  // namespace
+
+namespace impl {
+
+namespace {
+
+// q=0 (in any spelling: 0, 0., 0.00) disables a coding
+bool IsZeroQValue(std::string_view params) noexcept {
+  if (params.substr(0, 2) != "q=") return false;
+  const auto q_value = params.substr(2);
+  if (q_value.empty() || q_value.front() != '0') return false;
+  for (const char c : q_value) {
+    if (c != '0' && c != '.') return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+bool AcceptsGzip(std::string_view accept_encoding) noexcept {
+  // Per RFC 7231 an explicit "gzip" entry decides, whatever its position;
+  // "*" only covers codings not listed explicitly.
+  std::optional<bool> gzip_allowed;
+  std::optional<bool> wildcard_allowed;
+
+  while (!accept_encoding.empty()) {
+    const auto comma_pos = accept_encoding.find(',');
+    auto token = TrimSpaces(accept_encoding.substr(0, comma_pos));
+    accept_encoding = comma_pos == std::string_view::npos
+                          ? std::string_view{}
+                          : accept_encoding.substr(comma_pos + 1);
+
+    std::string_view params;
+    const auto semicolon_pos = token.find(';');
+    if (semicolon_pos != std::string_view::npos) {
+      params = TrimSpaces(token.substr(semicolon_pos + 1));
+      token = TrimSpaces(token.substr(0, semicolon_pos));
+    }
+
+    if (token == "gzip") {
+      if (!gzip_allowed) gzip_allowed = !IsZeroQValue(params);
+    } else if (token == "*") {
+      if (!wildcard_allowed) wildcard_allowed = !IsZeroQValue(params);
+    }
+  }
+
+  return gzip_allowed.value_or(wildcard_allowed.value_or(false));
+}
+
+}  // namespace impl
+
+ResponseCompression::ResponseCompression(
+    const ResponseCompressionFactory& factory, std::size_t min_response_size,
+    int level)
+    : factory_(factory), min_response_size_(min_response_size), level_(level) {}
+
+void ResponseCompression::HandleRequest(
+    http::HttpRequest& request, request::RequestContext& context) const {
+  Next(request, context);
+  CompressResponse(request);
+}
+
+void ResponseCompression::CompressResponse(http::HttpRequest& request) const {
+  auto& response = request.GetHttpResponse();
+
+  if (response.IsBodyStreamed()) return;
+  if (request.GetMethod() == http::HttpMethod::kHead) return;
+  const auto& data = response.GetData();
+  if (data.size() < min_response_size_) return;
+  if (response.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding))
+    return;
+  if (!impl::AcceptsGzip(request.GetHeader(
+          USERVER_NAMESPACE::http::headers::kAcceptEncoding)))
+    return;
+
+  const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime(
+      "http_compress_response_body");
+
+  std::string compressed;
+  try {
+    compressed = compression::gzip::Compress(data, level_);
+  } catch (const std::exception& ex) {
+    LOG_LIMITED_WARNING() << "Failed to compress response body: " << ex;
+    return;
+  }
+
+  if (compressed.size() >= data.size()) return;  // not worth it
+
+  auto& stats = factory_.GetStats();
+  stats.compressed_responses.Add(1);
+  stats.body_bytes_before.Add(data.size());
+  stats.body_bytes_after.Add(compressed.size());
+
+  response.SetHeader(USERVER_NAMESPACE::http::headers::kContentEncoding,
+                     "gzip");
+  // The representation now depends on the request's Accept-Encoding;
+  // without Vary an intermediary cache could serve the gzipped body to
+  // clients that did not offer gzip.
+  constexpr std::string_view kAcceptEncodingValue = "Accept-Encoding";
+  const auto& vary =
+      response.GetHeader(USERVER_NAMESPACE::http::headers::kVary);
+  if (vary.empty()) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kVary,
+                       std::string{kAcceptEncodingValue});
+  } else if (vary.find(kAcceptEncodingValue) == std::string::npos) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kVary,
+                       vary + ", " + std::string{kAcceptEncodingValue});
+  }
+  response.SetData(std::move(compressed));
+}
+
+ResponseCompressionFactory::ResponseCompressionFactory(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : HttpMiddlewareFactoryBase(config, context) {
+  auto& storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+  statistics_holder_ = storage.RegisterWriter(
+      "server.response-compression", [this](utils::statistics::Writer& writer) {
+        writer["compressed-responses"] =
+            stats_.compressed_responses.NonNegativeRead();
+        writer["body-bytes-before"] = stats_.body_bytes_before.NonNegativeRead();
+        writer["body-bytes-after"] = stats_.body_bytes_after.NonNegativeRead();
+      });
+}
+
+ResponseCompressionFactory::~ResponseCompressionFactory() {
+  statistics_holder_.Unregister();
+}
+
+std::unique_ptr<HttpMiddlewareBase> ResponseCompressionFactory::Create(
+    const handlers::HttpHandlerBase&,
+    yaml_config::YamlConfig middleware_config) const {
+  return std::make_unique<ResponseCompression>(
+      *this,
+      middleware_config["min-response-size"].As<std::size_t>(
+          kDefaultMinResponseSize),
+      middleware_config["level"].As<int>(kDefaultLevel));
+}
+
+yaml_config::Schema ResponseCompressionFactory::GetMiddlewareConfigSchema()
+    const {
+  return yaml_config::Schema{R"(
+type: object
+description: gzip response compression middleware settings
+additionalProperties: false
+properties:
+    min-response-size:
+        type: integer
+        description: responses smaller than this are not compressed
+        defaultDescription: 1024
+    level:
+        type: integer
+        description: zlib compression level, 1..9
+        defaultDescription: 6
+)"};
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include <userver/concurrent/striped_counter.hpp>
+#include <userver/server/middlewares/builtin.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+class ResponseCompressionFactory;
+
+namespace impl {
+
+// A deliberately small Accept-Encoding parser: finds the gzip (or '*')
+// coding and honors an explicit q=0. Exposed for tests.
+bool AcceptsGzip(std::string_view accept_encoding) noexcept;
+
+}  // namespace impl
+
+// Compresses non-streamed response bodies with gzip when the client accepts
+// it. Opt-in: add the middleware to the pipeline, tunables live in the
+// middleware config (min-response-size, level).
+class ResponseCompression final : public HttpMiddlewareBase {
+ public:
+  static constexpr std::string_view kName = builtin::kResponseCompression;
+
+  ResponseCompression(const ResponseCompressionFactory& factory,
+                      std::size_t min_response_size, int level);
+
+ private:
+  void HandleRequest(http::HttpRequest& request,
+                     request::RequestContext& context) const override;
+
+  void CompressResponse(http::HttpRequest& request) const;
+
+  const ResponseCompressionFactory& factory_;
+  const std::size_t min_response_size_;
+  const int level_;
+};
+
+class ResponseCompressionFactory final : public HttpMiddlewareFactoryBase {
+ public:
+  static constexpr std::string_view kName = ResponseCompression::kName;
+
+  ResponseCompressionFactory(const components::ComponentConfig&,
+                             const components::ComponentContext&);
+  ~ResponseCompressionFactory() override;
+
+  // bytes-saved == body_bytes_before - body_bytes_after
+  struct Stats final {
+    concurrent::StripedCounter compressed_responses;
+    concurrent::StripedCounter body_bytes_before;
+    concurrent::StripedCounter body_bytes_after;
+  };
+
+  Stats& GetStats() const noexcept { return stats_; }
+
+ private:
+  std::unique_ptr<HttpMiddlewareBase> Create(
+      const handlers::HttpHandlerBase&,
+      yaml_config::YamlConfig middleware_config) const override;
+
+  yaml_config::Schema GetMiddlewareConfigSchema() const override;
+
+  mutable Stats stats_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace server::middlewares
+
+template <>
+inline constexpr bool components::kHasValidate<
+    server::middlewares::ResponseCompressionFactory> = true;
+
+template <>
+inline constexpr auto components::kConfigFileMode<
+    server::middlewares::ResponseCompressionFactory> =
+    ConfigFileMode::kNotRequired;
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,50 @@
+#include <server/middlewares/compression.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using server::middlewares::impl::AcceptsGzip;
+
+TEST(ResponseCompressionAcceptsGzip, PlainCodings) {
+  EXPECT_TRUE(AcceptsGzip("gzip"));
+  EXPECT_TRUE(AcceptsGzip("gzip, deflate, br"));
+  EXPECT_TRUE(AcceptsGzip("deflate, gzip"));
+  EXPECT_TRUE(AcceptsGzip(" gzip "));
+  EXPECT_TRUE(AcceptsGzip("*"));
+
+  EXPECT_FALSE(AcceptsGzip(""));
+  EXPECT_FALSE(AcceptsGzip("identity"));
+  EXPECT_FALSE(AcceptsGzip("deflate, br"));
+  EXPECT_FALSE(AcceptsGzip("x-gzip"));  // not the gzip token
+}
+
+TEST(ResponseCompressionAcceptsGzip, QValues) {
+  EXPECT_TRUE(AcceptsGzip("gzip;q=1"));
+  EXPECT_TRUE(AcceptsGzip("gzip;q=0.5"));
+  EXPECT_TRUE(AcceptsGzip("gzip; q=0.5"));
+  EXPECT_TRUE(AcceptsGzip("gzip;q=0.01"));
+
+  EXPECT_FALSE(AcceptsGzip("gzip;q=0"));
+  EXPECT_FALSE(AcceptsGzip("gzip;q=0."));
+  EXPECT_FALSE(AcceptsGzip("gzip;q=0.0"));
+  EXPECT_FALSE(AcceptsGzip("gzip;q=0.00"));
+  EXPECT_FALSE(AcceptsGzip("gzip;q=0.000"));
+  EXPECT_FALSE(AcceptsGzip("*;q=0"));
+}
+
+TEST(ResponseCompressionAcceptsGzip, MixedLists) {
+  EXPECT_TRUE(AcceptsGzip("br;q=0, gzip;q=0.8"));
+  EXPECT_FALSE(AcceptsGzip("gzip;q=0, br"));
+  EXPECT_TRUE(AcceptsGzip("identity;q=0, gzip"));
+
+  // an explicit gzip entry decides regardless of position or wildcards
+  EXPECT_FALSE(AcceptsGzip("gzip;q=0, *"));
+  EXPECT_FALSE(AcceptsGzip("*, gzip;q=0"));
+  EXPECT_TRUE(AcceptsGzip("*;q=0, gzip"));
+  // '*' covers gzip only when gzip is not listed
+  EXPECT_TRUE(AcceptsGzip("br, *"));
+  EXPECT_FALSE(AcceptsGzip("br, *;q=0"));
+}
+
+USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 
 #include <server/middlewares/auth.hpp>
 #include <server/middlewares/baggage.hpp>
+#include <server/middlewares/compression.hpp>
 #include <server/middlewares/deadline_propagation.hpp>
 #include <server/middlewares/decompression.hpp>
 #include <server/middlewares/exceptions_handling.hpp>
@@ -62,6 +63,8 @@ components::ComponentList DefaultMiddlewareComponents() {
       .Append<AuthFactory>()
       .Append<DeadlinePropagationFactory>()
       .Append<DecompressionFactory>()
+      // opt-in: not in the default pipeline, add it per service/handler
+      .Append<ResponseCompressionFactory>()
       .Append<SetAcceptEncodingFactory>()
       .Append<ExceptionsHandlingFactory>()
       .Append<UnknownExceptionsHandlingFactory>()
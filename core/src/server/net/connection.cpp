@@ -21,6 +21,60 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+// Accumulates the bytes of several pipelined responses so that they leave in
+// one write syscall. Only used for non-streamed responses, which issue plain
+// WriteAll calls.
+class ResponseCoalescer final : public engine::io::RwBase {
+ public:
+  bool IsValid() const override { return true; }
+
+  bool WaitWriteable(engine::Deadline) override { return true; }
+
+  size_t WriteAll(const void* buf, size_t len, engine::Deadline) override {
+    buffer_.append(static_cast<const char*>(buf), len);
+    return len;
+  }
+
+  size_t WriteAll(const engine::io::IoData* list, std::size_t list_size,
+                  engine::Deadline) override {
+    size_t total = 0;
+    for (std::size_t i = 0; i < list_size; ++i) {
+      buffer_.append(static_cast<const char*>(list[i].data), list[i].len);
+      total += list[i].len;
+    }
+    return total;
+  }
+
+  bool WaitReadable(engine::Deadline) override {
+    UASSERT_MSG(false, "ResponseCoalescer is write-only");
+    return false;
+  }
+
+  size_t ReadSome(void*, size_t, engine::Deadline) override {
+    UASSERT_MSG(false, "ResponseCoalescer is write-only");
+    return 0;
+  }
+
+  size_t ReadAll(void*, size_t, engine::Deadline) override {
+    UASSERT_MSG(false, "ResponseCoalescer is write-only");
+    return 0;
+  }
+
+  const std::string& GetBuffer() const noexcept { return buffer_; }
+  std::size_t GetResponsesCount() const noexcept { return responses_count_; }
+
+  void AccountResponse() noexcept { ++responses_count_; }
+
+  void Clear() noexcept {
+    buffer_.clear();
+    responses_count_ = 0;
+  }
+
+ private:
+  std::string buffer_;
+  std::size_t responses_count_{0};
+};
+
 Connection::Connection(
     const ConnectionConfig& config,
     const request::HttpRequestConfig& handler_defaults_config,
@@ -137,8 +191,12 @@ void Connection::ListenForRequests() noexcept {
       }
       pending_data_size_ = 0;
 
-      for (auto&& request : pending_requests) {
-        ProcessRequest(std::move(request));
+      if (pending_requests.size() > 1) {
+        ProcessPipelinedRequests(pending_requests);
+      } else {
+        for (auto&& request : pending_requests) {
+          ProcessRequest(std::move(request));
+        }
       }
       pending_requests.resize(0);
       if (should_stop_accepting_requests) is_accepting_requests_ = false;
@@ -179,6 +237,87 @@ void Connection::ProcessRequest(
     request_ptr->DoUpgrade(std::move(peer_socket_), std::move(remote_address_));
 }
 
+void Connection::FlushCoalescedResponses() noexcept {
+  if (!active_coalescer_) return;
+  auto& coalescer = *active_coalescer_;
+
+  bool sent_ok = coalescer.GetBuffer().empty();
+  if (!coalescer.GetBuffer().empty() && peer_socket_) {
+    try {
+      const auto& buffer = coalescer.GetBuffer();
+      [[maybe_unused]] const auto sent =
+          peer_socket_->WriteAll(buffer.data(), buffer.size(), {});
+      stats_->coalesced_responses += coalescer.GetResponsesCount();
+      ++stats_->coalesced_flushes;
+      sent_ok = true;
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "I/O error while sending coalesced responses: " << ex;
+      // the remaining responses of the batch cannot be delivered in order
+      is_response_chain_valid_ = false;
+    }
+  }
+
+  // Only now is the send outcome of the buffered responses known: finish
+  // their deferred bookkeeping accordingly.
+  for (auto* const request : coalesced_pending_) {
+    if (!sent_ok) {
+      // the response was marked sent at serialization time, so the regular
+      // SetSendFailed transition does not apply
+      request->GetResponse().MarkBufferedSendFailed(
+          std::chrono::steady_clock::now());
+    }
+    FinishRequestAccounting(*request);
+  }
+  coalesced_pending_.clear();
+  coalescer.Clear();
+}
+
+void Connection::ProcessPipelinedRequests(
+    std::vector<std::shared_ptr<request::RequestBase>>& requests) {
+  ResponseCoalescer coalescer;
+  active_coalescer_ = &coalescer;
+  const utils::FastScopeGuard coalescer_guard{[this]() noexcept {
+    active_coalescer_ = nullptr;
+    // the pointees live in this batch; must not dangle into the next one
+    // if we unwind before the final flush
+    coalesced_pending_.clear();
+  }};
+
+  const auto flush = [this] { FlushCoalescedResponses(); };
+
+  for (auto&& request_ptr : requests) {
+    if (request_ptr->IsFinal()) {
+      is_accepting_requests_ = false;
+    }
+
+    stats_->active_request_count.Add(1);
+
+    auto task = HandleQueueItem(request_ptr);
+
+    // Streamed responses write interactively and websocket upgrades take the
+    // socket away, both must go through the direct path; everything already
+    // gathered goes out first to keep the response order.
+    const bool can_coalesce = is_response_chain_valid_ && peer_socket_ &&
+                              !request_ptr->GetResponse().IsBodyStreamed() &&
+                              !request_ptr->IsUpgradeWebsocket();
+    if (can_coalesce) {
+      if (BufferResponse(*request_ptr, coalescer)) {
+        coalescer.AccountResponse();
+        coalesced_pending_.push_back(request_ptr.get());
+      }
+    } else {
+      flush();
+      SendResponse(*request_ptr);
+      if (request_ptr->IsUpgradeWebsocket()) {
+        request_ptr->DoUpgrade(std::move(peer_socket_),
+                               std::move(remote_address_));
+      }
+    }
+  }
+
+  flush();
+}
+
 bool Connection::ReadSome() {
   if (pending_data_size_ == pending_data_.size()) return true;
 
@@ -216,6 +355,7 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(
   try {
     auto& response = request->GetResponse();
     if (response.IsBodyStreamed()) {
+      FlushCoalescedResponses();
       // TODO: wait for TCP connection closure too
       response.WaitForHeadersEnd();
     } else {
@@ -232,6 +372,10 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(
 
       request_task.WaitFor(config_.abort_check_delay);
       if (!request_task.IsFinished()) {
+        // The handler is slow: responses of a pipelined batch gathered so
+        // far must not wait for it.
+        FlushCoalescedResponses();
+
         // Slow path for not-so-fast handlers
         engine::io::ReadableBase& peer_read = *peer_socket_;
         const auto task_num = engine::WaitAny(peer_read, request_task);
@@ -290,6 +434,32 @@ void Connection::SendResponse(request::RequestBase& request) {
   } else {
     response.SetSendFailed(std::chrono::steady_clock::now());
   }
+  FinishRequestAccounting(request);
+}
+
+bool Connection::BufferResponse(request::RequestBase& request,
+                                ResponseCoalescer& coalescer) {
+  auto& response = request.GetResponse();
+  UASSERT(!response.IsSent());
+  request.SetStartSendResponseTime();
+  if (is_response_chain_valid_ && peer_socket_) {
+    try {
+      response.SendResponse(coalescer);
+      // success bookkeeping is deferred to FlushCoalescedResponses, where
+      // the bytes actually reach the socket
+      return true;
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Error while serializing response: " << ex;
+      response.SetSendFailed(std::chrono::steady_clock::now());
+    }
+  } else {
+    response.SetSendFailed(std::chrono::steady_clock::now());
+  }
+  FinishRequestAccounting(request);
+  return false;
+}
+
+void Connection::FinishRequestAccounting(request::RequestBase& request) {
   request.SetFinishSendResponseTime();
   stats_->active_request_count.Subtract(1);
   stats_->requests_processed_count.Add(1);
@@ -17,6 +17,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+class ResponseCoalescer;
+
 class Connection final {
  public:
   enum class Type { kRequest, kMonitor };
@@ -41,10 +43,31 @@ class Connection final {
   void ListenForRequests() noexcept;
   void ProcessRequest(std::shared_ptr<request::RequestBase>&& request_ptr);
 
+  // Serves a batch of pipelined requests, gathering their responses into a
+  // single write syscall where possible.
+  void ProcessPipelinedRequests(
+      std::vector<std::shared_ptr<request::RequestBase>>& requests);
+
   engine::TaskWithResult<void> HandleQueueItem(
       const std::shared_ptr<request::RequestBase>& request) noexcept;
   void SendResponse(request::RequestBase& request);
 
+  // Serializes the response into the coalescer without the terminal
+  // accounting, which is deferred to the flush (where the send outcome is
+  // actually known). Returns false when the response could not even be
+  // serialized; such a request is fully accounted as failed right away.
+  bool BufferResponse(request::RequestBase& request,
+                      ResponseCoalescer& coalescer);
+
+  // The terminal per-request bookkeeping: send-finish time, counters and
+  // access logs. Must run exactly once per request.
+  void FinishRequestAccounting(request::RequestBase& request);
+
+  // Sends out everything gathered so far and finishes the accounting of the
+  // buffered requests (as failed if the write fails); no-op outside of a
+  // pipelined batch.
+  void FlushCoalescedResponses() noexcept;
+
   std::string Getpeername() const;
 
   bool ReadSome();
@@ -64,6 +87,10 @@ class Connection final {
 
   bool is_accepting_requests_{true};
   bool is_response_chain_valid_{true};
+  ResponseCoalescer* active_coalescer_{nullptr};
+  // requests whose responses sit in the active coalescer, in send order;
+  // the pointees are owned by the batch in ProcessPipelinedRequests
+  std::vector<request::RequestBase*> coalesced_pending_;
 };
 
 }  // namespace server::net
@@ -0,0 +1,123 @@
+#include <server/net/connection.hpp>
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/http/http_request_impl.hpp>
+#include <server/http/request_handler_base.hpp>
+#include <server/net/create_socket.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/run_standalone.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace net = server::net;
+
+// End-to-end accept -> parse -> handle -> respond pipeline over a real
+// loopback socket. The handler is a noop, so the numbers isolate the server
+// machinery itself; args are (pipeline depth).
+
+class NoopHandler final : public server::http::RequestHandlerBase {
+ public:
+  engine::TaskWithResult<void> StartRequestTask(
+      std::shared_ptr<server::request::RequestBase> request) const override {
+    auto& http_request = dynamic_cast<server::http::HttpRequestImpl&>(*request);
+    static server::handlers::HttpRequestStatistics statistics;
+    http_request.SetHttpHandlerStatistics(statistics);
+    return engine::AsyncNoSpan([] {});
+  }
+
+  const server::http::HandlerInfoIndex& GetHandlerInfoIndex() const override {
+    return handler_info_index_;
+  }
+
+  const logging::LoggerPtr& LoggerAccess() const noexcept override {
+    return no_logger_;
+  }
+  const logging::LoggerPtr& LoggerAccessTskv() const noexcept override {
+    return no_logger_;
+  }
+
+ private:
+  logging::LoggerPtr no_logger_;
+  server::http::HandlerInfoIndex handler_info_index_;
+};
+
+std::string ReceiveResponses(engine::io::Socket& client,
+                             std::size_t expected_count) {
+  std::string received;
+  std::size_t responses_seen = 0;
+  char buffer[4096];
+  while (responses_seen < expected_count) {
+    const auto bytes = client.RecvSome(buffer, sizeof(buffer), {});
+    if (bytes == 0) break;
+    received.append(buffer, bytes);
+    responses_seen = 0;
+    for (std::size_t pos = 0;
+         (pos = received.find("\r\n\r\n", pos)) != std::string::npos;
+         pos += 4) {
+      ++responses_seen;
+    }
+  }
+  return received;
+}
+
+void http_connection_pipeline(benchmark::State& state) {
+  engine::RunStandalone(2, [&] {
+    const auto pipeline_depth = static_cast<std::size_t>(state.range(0));
+
+    net::ListenerConfig config;
+    config.handler_defaults = server::request::HttpRequestConfig{};
+    auto request_socket = net::CreateSocket(config);
+
+    engine::io::Sockaddr addr = request_socket.Getsockname();
+    auto client_task = engine::AsyncNoSpan([&addr] {
+      engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+      client.Connect(addr, {});
+      return client;
+    });
+
+    auto peer = request_socket.Accept({});
+    auto client = client_task.Get();
+
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    NoopHandler handler;
+
+    auto server_task = engine::AsyncNoSpan([&] {
+      net::Connection connection(
+          config.connection_config, config.handler_defaults,
+          std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
+          stats, data_accounter);
+      connection.Process();
+    });
+
+    std::string request_batch;
+    for (std::size_t i = 0; i < pipeline_depth; ++i) {
+      request_batch += "GET /bench HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+      [[maybe_unused]] const auto sent =
+          client.SendAll(request_batch.data(), request_batch.size(), {});
+      const auto responses = ReceiveResponses(client, pipeline_depth);
+      benchmark::DoNotOptimize(responses);
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(pipeline_depth));
+
+    client.Close();
+    server_task.WaitFor(std::chrono::seconds{5});
+  });
+}
+BENCHMARK(http_connection_pipeline)->Arg(1)->Arg(4)->Arg(16);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
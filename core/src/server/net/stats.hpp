@@ -35,6 +35,11 @@ struct Stats {
   std::atomic<size_t> connections_created{0};
   std::atomic<size_t> connections_closed{0};
 
+  // pipelined response write coalescing;
+  // responses-per-syscall == coalesced_responses / coalesced_flushes
+  std::atomic<size_t> coalesced_responses{0};
+  std::atomic<size_t> coalesced_flushes{0};
+
   // per connection
   ParserStats parser_stats;
   concurrent::StripedCounter active_request_count;
@@ -48,6 +53,8 @@ struct StatsAggregation final {
       : active_connections{stats.active_connections.load()},
         connections_created{stats.connections_created.load()},
         connections_closed{stats.connections_closed.load()},
+        coalesced_responses{stats.coalesced_responses.load()},
+        coalesced_flushes{stats.coalesced_flushes.load()},
         parser_stats{stats.parser_stats},
         active_request_count{stats.active_request_count.NonNegativeRead()},
         requests_processed_count{stats.requests_processed_count.Read()} {}
@@ -56,6 +63,8 @@ struct StatsAggregation final {
     active_connections += other.active_connections;
     connections_created += other.connections_created;
     connections_closed += other.connections_closed;
+    coalesced_responses += other.coalesced_responses;
+    coalesced_flushes += other.coalesced_flushes;
 
     parser_stats += other.parser_stats;
     active_request_count += other.active_request_count;
@@ -67,6 +76,8 @@ struct StatsAggregation final {
   std::size_t active_connections{0};
   std::size_t connections_created{0};
   std::size_t connections_closed{0};
+  std::size_t coalesced_responses{0};
+  std::size_t coalesced_flushes{0};
 
   // per connection
   ParserStatsAggregation parser_stats;
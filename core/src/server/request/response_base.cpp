@@ -79,6 +79,13 @@ void ResponseBase::SetSendFailed(
   SetSent(0, failure_time);
 }
 
+void ResponseBase::MarkBufferedSendFailed(
+    std::chrono::steady_clock::time_point failure_time) {
+  UASSERT(is_sent_);
+  bytes_sent_ = 0;
+  sent_time_ = failure_time;
+}
+
 void ResponseBase::SetSent(std::size_t bytes_sent,
                            std::chrono::steady_clock::time_point sent_time) {
   UASSERT(!is_sent_);
@@ -117,6 +117,7 @@ class ServerImpl final {
   std::chrono::milliseconds GetAvgRequestTimeMs() const;
   const http::HttpRequestHandler& GetHttpRequestHandler(bool is_monitor) const;
   net::StatsAggregation GetServerStats() const;
+  std::vector<net::StatsAggregation> GetPerListenerStats() const;
   const ServerConfig& GetServerConfig() const { return config_; }
   const std::vector<std::string>& GetMiddlewares() const;
 
@@ -273,6 +274,19 @@ net::StatsAggregation ServerImpl::GetServerStats() const {
   return summary;
 }
 
+std::vector<net::StatsAggregation> ServerImpl::GetPerListenerStats() const {
+  std::vector<net::StatsAggregation> result;
+
+  std::shared_lock lock{on_stop_mutex_};
+  if (is_stopping_) return result;
+  result.reserve(main_port_info_.listeners_.size());
+  for (const auto& listener : main_port_info_.listeners_) {
+    result.push_back(listener.GetStats());
+  }
+
+  return result;
+}
+
 const std::vector<std::string>& ServerImpl::GetMiddlewares() const {
   return middlewares_;
 }
@@ -351,6 +365,19 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
     conn_stats["active"] = server_stats.active_connections;
     conn_stats["opened"] = server_stats.connections_created;
     conn_stats["closed"] = server_stats.connections_closed;
+    conn_stats["coalesced-responses"] = server_stats.coalesced_responses;
+    conn_stats["coalesced-flushes"] = server_stats.coalesced_flushes;
+
+    // Each listener shard accepts on its own SO_REUSEPORT socket; these
+    // counters show how evenly the kernel distributes incoming connections.
+    const auto per_listener_stats = pimpl->GetPerListenerStats();
+    if (per_listener_stats.size() > 1) {
+      for (std::size_t i = 0; i < per_listener_stats.size(); ++i) {
+        conn_stats["accepted-by-listener"].ValueWithLabels(
+            per_listener_stats[i].connections_created,
+            {{"listener_shard", std::to_string(i)}});
+      }
+    }
   }
 
   if (auto request_stats = writer["requests"]) {
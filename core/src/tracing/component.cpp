@@ -36,6 +36,8 @@ Tracer::Tracer(const ComponentConfig& config, const ComponentContext& context) {
   } else {
     throw std::runtime_error("Tracer type is not supported: " + tracer_type);
   }
+
+  tracing::Tracer::SetSampleRate(config["sampling-rate"].As<double>(1.0));
 }
 
 yaml_config::Schema Tracer::GetStaticConfigSchema() {
@@ -52,6 +54,12 @@ properties:
         type: string
         description: type of the tracer to trace, currently supported only 'native'
         defaultDescription: 'native'
+    sampling-rate:
+        type: number
+        description: |
+            head-based sampling: the fraction (0..1) of new traces whose
+            spans are logged; spans tagged with an error are always logged
+        defaultDescription: 1.0
 )");
 }
 
@@ -11,6 +11,7 @@
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/hex.hpp>
@@ -96,6 +97,9 @@ Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
   if (parent) {
     log_extra_inheritable_ = parent->log_extra_inheritable_;
     local_log_level_ = parent->local_log_level_;
+    is_trace_sampled_ = parent->is_trace_sampled_;
+  } else {
+    is_trace_sampled_ = Tracer::ShouldSampleNewTrace();
   }
 }
 
@@ -184,7 +188,8 @@ bool Span::Impl::ShouldLog() const {
   /* We must honour default log level, but use span's level from ourselves,
    * not the previous span's.
    */
-  return logging::impl::ShouldLogNoSpan(logging::GetDefaultLogger(),
+  return is_trace_sampled_ &&
+         logging::impl::ShouldLogNoSpan(logging::GetDefaultLogger(),
                                         log_level_) &&
          local_log_level_.value_or(logging::Level::kTrace) <= log_level_;
 }
@@ -335,6 +340,8 @@ std::optional<logging::Level> Span::GetLocalLogLevel() const {
 }
 
 void Span::AddTag(std::string key, logging::LogExtra::Value value) {
+  // always-sample-on-error escalation
+  if (key == kErrorFlag) pimpl_->is_trace_sampled_ = true;
   pimpl_->log_extra_inheritable_.Extend(std::move(key), std::move(value));
 }
 
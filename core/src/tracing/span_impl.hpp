@@ -84,6 +84,9 @@ class Span::Impl
   const bool is_no_log_span_;
   logging::Level log_level_;
   std::optional<logging::Level> local_log_level_;
+  // Head-based sampling decision, inherited from the parent span within a
+  // trace; an error tag escalates the span back to logging.
+  bool is_trace_sampled_{true};
 
   std::shared_ptr<Tracer> tracer_;
   logging::LogExtra log_extra_inheritable_;
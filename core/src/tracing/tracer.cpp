@@ -1,9 +1,12 @@
 #include <userver/tracing/tracer.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <cstdint>
 
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/utils/rand.hpp>
 #include <userver/utils/uuid4.hpp>
 
 #include <tracing/no_log_spans.hpp>
@@ -83,6 +86,26 @@ bool Tracer::IsNoLogSpan(const std::string& name) {
          spans->names.find(name) != spans->names.end();
 }
 
+namespace {
+
+// parts per million, full sampling by default
+std::atomic<std::uint32_t> sample_rate_ppm{1'000'000};
+
+}  // namespace
+
+void Tracer::SetSampleRate(double rate) noexcept {
+  const auto clamped = std::clamp(rate, 0.0, 1.0);
+  sample_rate_ppm.store(static_cast<std::uint32_t>(clamped * 1'000'000),
+                        std::memory_order_relaxed);
+}
+
+bool Tracer::ShouldSampleNewTrace() noexcept {
+  const auto ppm = sample_rate_ppm.load(std::memory_order_relaxed);
+  if (ppm >= 1'000'000) return true;
+  if (ppm == 0) return false;
+  return utils::RandRange(1'000'000u) < ppm;
+}
+
 void Tracer::SetTracer(std::shared_ptr<Tracer> tracer) {
   GlobalTracer().Assign(std::move(tracer));
 }
@@ -2,12 +2,15 @@
 
 #include <algorithm>
 #include <iterator>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
 #include <userver/utils/impl/transparent_hash.hpp>
+#include <userver/utils/numconv.hpp>
 #include <userver/utils/overloaded.hpp>
 #include <userver/utils/statistics/fmt.hpp>
 #include <userver/utils/statistics/storage.hpp>
@@ -22,6 +25,39 @@ namespace {
 
 enum class Typed { kYes, kNo };
 
+// Metric paths and label names are stable across scrapes, while the
+// conversion allocates and walks every byte; memoize the converted form
+// process-wide so a scrape only formats values. References into the maps
+// stay valid on insertion (std::unordered_map guarantees it).
+template <typename Convert>
+const std::string& MemoizeConversion(std::string_view key, Convert convert) {
+  static std::shared_mutex mutex;
+  static utils::impl::TransparentMap<std::string, std::string> cache;
+
+  {
+    const std::shared_lock lock(mutex);
+    if (const auto* const converted =
+            utils::impl::FindTransparentOrNullptr(cache, key)) {
+      return *converted;
+    }
+  }
+
+  auto converted = convert(key);
+  const std::unique_lock lock(mutex);
+  return cache.try_emplace(std::string{key}, std::move(converted))
+      .first->second;
+}
+
+const std::string& GetCachedPrometheusName(std::string_view path) {
+  return MemoizeConversion(
+      path, [](std::string_view key) { return impl::ToPrometheusName(key); });
+}
+
+const std::string& GetCachedPrometheusLabel(std::string_view name) {
+  return MemoizeConversion(
+      name, [](std::string_view key) { return impl::ToPrometheusLabel(key); });
+}
+
 template <Typed IsTyped>
 class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
  public:
@@ -67,24 +103,40 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
                        const MetricValue& value) {
     static constexpr std::string_view kBucket = "bucket";
 
-    const auto prometheus_name = impl::ToPrometheusName(path);
+    const auto& prometheus_name = GetCachedPrometheusName(path);
     DumpMetricType(prometheus_name, value);
 
     auto histogram = value.AsHistogram();
     const auto bucket_count = histogram.GetBucketCount();
+
+    // the hottest formatting loop of a scrape: one bound and one counter
+    // per bucket per histogram series, rendered via the numconv kernels
+    // into stack buffers
+    char bound_buffer[numconv::kMaxDoubleChars];
+    char value_buffer[numconv::kMaxIntegerChars];
+
     std::uint64_t cumulative_sum = 0;
     for (std::size_t i = 0; i < bucket_count; ++i) {
       cumulative_sum += histogram.GetValueAt(i);
-      AppendHistogramMetric(kBucket, prometheus_name,
-                            fmt::to_string(histogram.GetUpperBoundAt(i)),
-                            fmt::to_string(cumulative_sum), labels);
+      const std::string_view bound{
+          bound_buffer,
+          numconv::ToChars(histogram.GetUpperBoundAt(i), bound_buffer)};
+      const std::string_view count{
+          value_buffer, numconv::ToChars(cumulative_sum, value_buffer)};
+      AppendHistogramMetric(kBucket, prometheus_name, bound, count, labels);
     }
     cumulative_sum += histogram.GetValueAtInf();
-    AppendHistogramMetric(kBucket, prometheus_name, "+Inf",
-                          fmt::to_string(cumulative_sum), labels);
-    AppendHistogramMetric("count", prometheus_name,
-                          /* upper_bound */ "",
-                          fmt::to_string(histogram.GetTotalCount()), labels);
+    AppendHistogramMetric(
+        kBucket, prometheus_name, "+Inf",
+        std::string_view{value_buffer,
+                         numconv::ToChars(cumulative_sum, value_buffer)},
+        labels);
+    AppendHistogramMetric(
+        "count", prometheus_name, /* upper_bound */ "",
+        std::string_view{
+            value_buffer,
+            numconv::ToChars(histogram.GetTotalCount(), value_buffer)},
+        labels);
   }
 
   void DumpMetricNameAndType(std::string_view name, const MetricValue& value) {
@@ -94,10 +146,10 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
       return;
     }
 
-    auto prometheus_name = impl::ToPrometheusName(name);
+    const auto& prometheus_name = GetCachedPrometheusName(name);
     DumpMetricType(prometheus_name, value);
     buf_.append(prometheus_name);
-    metrics_.emplace(name, std::move(prometheus_name));
+    metrics_.emplace(name, prometheus_name);
   }
 
   void DumpMetricType([[maybe_unused]] std::string_view prometheus_name,
@@ -129,7 +181,7 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
         buf_.push_back(',');
       }
       fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}=\""),
-                     impl::ToPrometheusLabel(label.Name()));
+                     GetCachedPrometheusLabel(label.Name()));
       const auto& value = label.Value();
       std::replace_copy(value.cbegin(), value.cend(), std::back_inserter(buf_),
                         '"', '\'');
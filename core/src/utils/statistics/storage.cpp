@@ -119,6 +119,10 @@ void Storage::VisitMetrics(BaseFormatBuilder& out,
                            const Request& request) const {
   {
     impl::WriterState state{out, request, {}, {}};
+    // The path buffer is shared by the whole traversal (append + truncate
+    // per node); reserving once avoids the growth reallocations at the
+    // start of every scrape.
+    state.path.reserve(256);
     for (const auto& [name, value] : request.add_labels) {
       state.add_labels.emplace_back(name, value);
     }
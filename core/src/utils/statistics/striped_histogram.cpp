@@ -0,0 +1,50 @@
+#include <userver/utils/statistics/striped_histogram.hpp>
+
+#include <thread>
+
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace {
+
+constexpr std::size_t kShardCount = 16;
+
+std::size_t GetThreadShardIndex() noexcept {
+  static thread_local const std::size_t index =
+      std::hash<std::thread::id>{}(std::this_thread::get_id()) % kShardCount;
+  return index;
+}
+
+}  // namespace
+
+StripedHistogram::StripedHistogram(utils::span<const double> upper_bounds)
+    : upper_bounds_(upper_bounds.begin(), upper_bounds.end()),
+      shards_(utils::GenerateFixedArray(kShardCount, [&](std::size_t) {
+        return Histogram{upper_bounds};
+      })) {}
+
+void StripedHistogram::Account(double value, std::uint64_t count) noexcept {
+  shards_[GetThreadShardIndex()].Account(value, count);
+}
+
+Histogram StripedHistogram::Collapse() const {
+  HistogramAggregator aggregator{upper_bounds_};
+  for (const auto& shard : shards_) {
+    aggregator.Add(shard.GetView());
+  }
+  return Histogram{aggregator.GetView()};
+}
+
+void DumpMetric(Writer& writer, const StripedHistogram& histogram) {
+  const auto collapsed = histogram.Collapse();
+  writer = collapsed.GetView();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
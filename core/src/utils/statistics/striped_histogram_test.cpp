@@ -0,0 +1,48 @@
+#include <userver/utils/statistics/striped_histogram.hpp>
+
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/histogram_view.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+const std::vector<double> kBounds{10, 100, 1000};
+}
+
+UTEST(StripedHistogram, SingleThreadAccounting) {
+  utils::statistics::StripedHistogram histogram{kBounds};
+  histogram.Account(5);
+  histogram.Account(50, 2);
+  histogram.Account(5000);
+
+  const auto collapsed = histogram.Collapse();
+  const auto view = collapsed.GetView();
+  EXPECT_EQ(view.GetTotalCount(), 4);
+  EXPECT_EQ(view.GetValueAt(0), 1);
+  EXPECT_EQ(view.GetValueAt(1), 2);
+  EXPECT_EQ(view.GetValueAt(2), 0);
+  EXPECT_EQ(view.GetValueAtInf(), 1);
+}
+
+UTEST_MT(StripedHistogram, ConcurrentRecording, 4) {
+  utils::statistics::StripedHistogram histogram{kBounds};
+
+  constexpr int kTasks = 8;
+  constexpr int kPerTask = 1000;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasks);
+  for (int i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&histogram] {
+      for (int j = 0; j < kPerTask; ++j) histogram.Account(50);
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_EQ(histogram.Collapse().GetView().GetTotalCount(),
+            kTasks * kPerTask);
+}
+
+USERVER_NAMESPACE_END
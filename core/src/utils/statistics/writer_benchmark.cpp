@@ -0,0 +1,69 @@
+#include <userver/utils/statistics/writer.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Measures the full Storage::VisitMetrics walk over a deep labeled tree:
+// the per-node costs are path building and label stack maintenance in
+// utils::statistics::Writer.
+
+class CountingBuilder final : public utils::statistics::BaseFormatBuilder {
+ public:
+  void HandleMetric(std::string_view, utils::statistics::LabelsSpan,
+                    const utils::statistics::MetricValue&) override {
+    ++count_;
+  }
+
+  std::size_t GetCount() const noexcept { return count_; }
+
+ private:
+  std::size_t count_{0};
+};
+
+void WriteDeep(utils::statistics::Writer&& node, std::size_t depth) {
+  if (depth == 0) {
+    node.ValueWithLabels(
+        42, {{"first_label", "value"}, {"second_label", "value"}});
+    return;
+  }
+  WriteDeep(node["level-" + std::to_string(depth)], depth - 1);
+}
+
+void statistics_visit_metrics_deep_tree(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto depth = static_cast<std::size_t>(state.range(0));
+    const auto width = static_cast<std::size_t>(state.range(1));
+
+    utils::statistics::Storage storage;
+    auto holder = storage.RegisterWriter(
+        "root", [&](utils::statistics::Writer& writer) {
+          for (std::size_t i = 0; i < width; ++i) {
+            WriteDeep(writer["branch-" + std::to_string(i)], depth);
+          }
+        });
+
+    for ([[maybe_unused]] auto _ : state) {
+      CountingBuilder builder;
+      storage.VisitMetrics(builder, utils::statistics::Request{});
+      benchmark::DoNotOptimize(builder.GetCount());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(width));
+
+    holder.Unregister();
+  });
+}
+BENCHMARK(statistics_visit_metrics_deep_tree)
+    ->Args({4, 100})
+    ->Args({8, 100})
+    ->Args({8, 1000});
+
+}  // namespace
+
+USERVER_NAMESPACE_END
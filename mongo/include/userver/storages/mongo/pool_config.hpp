@@ -69,6 +69,11 @@ struct PoolConfig final {
 
   /// Application name (sent to server)
   std::string app_name = kDefaultAppName;
+
+  /// Wire protocol compressors to offer the server, in preference order
+  /// (e.g. "snappy,zstd,zlib"); empty keeps compression off. The server
+  /// picks the first mutually supported one.
+  std::string compressors{};
   /// Default max replication lag for the pool
   std::optional<std::chrono::seconds> max_replication_lag;
 
@@ -94,6 +94,14 @@ UriPtr MakeUri(const std::string& pool_id, const std::string& uri_string,
         CheckedDurationMs(*config.local_threshold,
                           MONGOC_URI_LOCALTHRESHOLDMS));
   }
+  if (!config.compressors.empty()) {
+    // the server negotiates the first mutually supported compressor;
+    // unsupported names are rejected by the driver here
+    if (!mongoc_uri_set_compressors(uri.get(), config.compressors.c_str())) {
+      throw InvalidConfigException("Invalid compressors list '")
+          << config.compressors << "' for pool '" << pool_id << '\'';
+    }
+  }
   if (config.max_replication_lag) {
     const auto max_repl_lag_sec =
         std::chrono::duration_cast<std::chrono::seconds>(
@@ -137,6 +137,12 @@ properties:
         type: string
         description: application name for the DB server
         defaultDescription: userver
+    compressors:
+        type: string
+        description: |
+            wire protocol compressors to offer the server in preference
+            order, e.g. 'snappy,zstd,zlib'; empty disables compression
+        defaultDescription: ''
     conn_timeout:
         type: string
         description: connection timeout
@@ -74,6 +74,8 @@ PoolConfig Parse(const yaml_config::YamlConfig& config,
       config["maintenance_period"].As<std::chrono::milliseconds>(
           result.maintenance_period);
   result.app_name = config["appname"].As<std::string>(result.app_name);
+  result.compressors =
+      config["compressors"].As<std::string>(result.compressors);
   result.max_replication_lag =
       config["max_replication_lag"].As<std::optional<std::chrono::seconds>>();
   result.driver_impl =
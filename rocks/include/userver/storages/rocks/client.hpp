@@ -3,8 +3,11 @@
 /// @file userver/storages/rocks/client.hpp
 /// @brief @copybrief storages::rocks::Client
 
+#include <cstddef>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <rocksdb/db.h>
 
@@ -23,15 +26,27 @@ namespace storages::rocks {
  */
 class Client final {
  public:
+  /**
+   * @brief Tuning knobs of the underlying RocksDB instance.
+   */
+  struct Settings final {
+    /// Shared block cache size; 0 keeps the RocksDB default cache
+    std::size_t block_cache_size_bytes{0};
+    /// Bloom filter bits per key for point-read filtering; 0 disables
+    int bloom_filter_bits_per_key{0};
+  };
+
   /**
    * @brief Constructor of the Client class.
    *
    * @param db_path The path to the RocksDB database.
    * @param blocking_task_processor - task processor to execute blocking FS
    * operations
+   * @param settings storage tuning, see Settings
    */
   Client(const std::string& db_path,
-         engine::TaskProcessor& blocking_task_processor);
+         engine::TaskProcessor& blocking_task_processor,
+         const Settings& settings = Settings{});
 
   /**
    * @brief Puts a record into the database.
@@ -55,6 +70,15 @@ class Client final {
    */
   void Delete(std::string_view key);
 
+  /**
+   * @brief Retrieves several records in one storage round-trip.
+   *
+   * @param keys The keys to look up.
+   * @returns values aligned with `keys`; missing keys yield std::nullopt.
+   */
+  std::vector<std::optional<std::string>> MultiGet(
+      const std::vector<std::string>& keys);
+
   /**
    * Checks the status of an operation and handles any errors based on the given
    * method name.
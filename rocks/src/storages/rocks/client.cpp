@@ -1,6 +1,9 @@
 #include <userver/storages/rocks/client.hpp>
 
 #include <fmt/format.h>
+#include <rocksdb/cache.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/table.h>
 
 #include <userver/storages/rocks/exception.hpp>
 #include <userver/utils/async.hpp>
@@ -10,11 +13,27 @@ USERVER_NAMESPACE_BEGIN
 namespace storages::rocks {
 
 Client::Client(const std::string& db_path,
-               engine::TaskProcessor& blocking_task_processor)
+               engine::TaskProcessor& blocking_task_processor,
+               const Settings& settings)
     : blocking_task_processor_(blocking_task_processor) {
   rocksdb::Options options;
   options.create_if_missing = true;
 
+  if (settings.block_cache_size_bytes != 0 ||
+      settings.bloom_filter_bits_per_key != 0) {
+    rocksdb::BlockBasedTableOptions table_options;
+    if (settings.block_cache_size_bytes != 0) {
+      table_options.block_cache =
+          rocksdb::NewLRUCache(settings.block_cache_size_bytes);
+    }
+    if (settings.bloom_filter_bits_per_key != 0) {
+      table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(
+          settings.bloom_filter_bits_per_key));
+    }
+    options.table_factory.reset(
+        rocksdb::NewBlockBasedTableFactory(table_options));
+  }
+
   rocksdb::DB* db{};
   rocksdb::Status status = rocksdb::DB::Open(options, db_path, &db);
   db_.reset(db);
@@ -50,6 +69,34 @@ void Client::Delete(std::string_view key) {
       .Get();
 }
 
+std::vector<std::optional<std::string>> Client::MultiGet(
+    const std::vector<std::string>& keys) {
+  return engine::AsyncNoSpan(
+             blocking_task_processor_,
+             [this, &keys] {
+               std::vector<rocksdb::Slice> slices;
+               slices.reserve(keys.size());
+               for (const auto& key : keys) slices.emplace_back(key);
+
+               std::vector<std::string> values;
+               const auto statuses =
+                   db_->MultiGet(rocksdb::ReadOptions(), slices, &values);
+
+               std::vector<std::optional<std::string>> result;
+               result.reserve(keys.size());
+               for (std::size_t i = 0; i < keys.size(); ++i) {
+                 if (statuses[i].IsNotFound()) {
+                   result.emplace_back(std::nullopt);
+                   continue;
+                 }
+                 CheckStatus(statuses[i], "MultiGet");
+                 result.emplace_back(std::move(values[i]));
+               }
+               return result;
+             })
+      .Get();
+}
+
 void Client::CheckStatus(rocksdb::Status status, std::string_view method_name) {
   if (!status.ok() && !status.IsNotFound()) {
     throw USERVER_NAMESPACE::storages::rocks::RequestFailedException(
@@ -25,6 +25,20 @@ UTEST(Rocks, CheckCRUD) {
   EXPECT_EQ("", res);
 }
 
+UTEST(Rocks, MultiGet) {
+  storages::rocks::Client client{"/tmp/rocksdb_multiget_example",
+                                 engine::current_task::GetTaskProcessor()};
+
+  client.Put("first", "1");
+  client.Put("second", "2");
+
+  const auto values = client.MultiGet({"first", "missing", "second"});
+  ASSERT_EQ(values.size(), 3);
+  EXPECT_EQ(values[0], "1");
+  EXPECT_EQ(values[1], std::nullopt);
+  EXPECT_EQ(values[2], "2");
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -15,7 +15,11 @@ Component::Component(const components::ComponentConfig& config,
       client_ptr_(std::make_shared<storages::rocks::Client>(
           config["db-path"].As<std::string>(),
           context.GetTaskProcessor(
-              config["task-processor"].As<std::string>()))) {}
+              config["task-processor"].As<std::string>()),
+          Client::Settings{
+              config["block-cache-size"].As<std::size_t>(0),
+              config["bloom-filter-bits-per-key"].As<int>(0),
+          })) {}
 
 storages::rocks::ClientPtr Component::MakeClient() { return client_ptr_; }
 
@@ -31,6 +35,14 @@ properties:
     db-path:
         type: string
         description: path to database file
+    block-cache-size:
+        type: integer
+        description: shared block cache size in bytes, 0 keeps the default
+        defaultDescription: 0
+    bloom-filter-bits-per-key:
+        type: integer
+        description: bloom filter bits per key for point reads, 0 disables
+        defaultDescription: 0
 )");
 }
 }  // namespace storages::rocks
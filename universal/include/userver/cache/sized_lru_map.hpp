@@ -0,0 +1,115 @@
+#pragma once
+
+/// @file userver/cache/sized_lru_map.hpp
+/// @brief @copybrief cache::SizedLruMap
+
+#include <cstddef>
+#include <functional>
+
+#include <userver/cache/impl/lru.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// Default entry weight: the value's size() plus a fixed per-entry overhead.
+struct DefaultSizeOf final {
+  template <typename U>
+  std::size_t operator()(const U& value) const noexcept {
+    return value.size() + 64;
+  }
+};
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief An LRU map with weighted (byte-based) capacity on top of the
+/// entry-count limit.
+///
+/// Each value's weight comes from the user-supplied size functor; Put evicts
+/// least-recently-used entries until both the byte budget and the entry
+/// budget hold, and an entry heavier than the whole budget is rejected
+/// outright rather than flushing the cache for it. GetTotalWeight() is the
+/// resident-bytes figure for per-cache metrics.
+///
+/// Not thread-safe, same as LruMap.
+template <typename T, typename U, typename SizeOf = DefaultSizeOf,
+          typename Hash = std::hash<T>, typename Equal = std::equal_to<T>>
+class SizedLruMap final {
+ public:
+  SizedLruMap(std::size_t max_entries, std::size_t max_total_weight,
+              SizeOf size_of = SizeOf{}, const Hash& hash = Hash{},
+              const Equal& equal = Equal{})
+      : impl_(max_entries, hash, equal),
+        max_entries_(max_entries),
+        max_total_weight_(max_total_weight),
+        size_of_(std::move(size_of)) {
+    UASSERT(max_entries > 0);
+  }
+
+  SizedLruMap(const SizedLruMap&) = delete;
+  SizedLruMap& operator=(const SizedLruMap&) = delete;
+
+  /// @returns false when the entry is heavier than the whole budget (the
+  /// cache is left untouched), true otherwise.
+  bool Put(const T& key, U value) {
+    const auto weight = size_of_(value);
+    if (weight > max_total_weight_) return false;
+
+    // replace == erase + insert, so the weight accounting never sees the
+    // old node during eviction
+    Erase(key);
+
+    // never let the intrusive base evict on its own: its internal
+    // replacement would bypass the weight accounting
+    EvictDownTo(max_entries_ - 1, max_total_weight_ - weight);
+
+    impl_.Put(key, std::move(value));
+    total_weight_ += weight;
+    return true;
+  }
+
+  U* Get(const T& key) { return impl_.Get(key); }
+
+  void Erase(const T& key) {
+    if (auto* existing = impl_.Get(key)) {
+      total_weight_ -= size_of_(*existing);
+      impl_.Erase(key);
+    }
+  }
+
+  std::size_t GetSize() const { return impl_.GetSize(); }
+
+  /// Resident weight (bytes with the default functor) of all entries.
+  std::size_t GetTotalWeight() const noexcept { return total_weight_; }
+
+  void Clear() noexcept {
+    impl_.Clear();
+    total_weight_ = 0;
+  }
+
+  template <typename Function>
+  void VisitAll(Function&& func) const {
+    impl_.VisitAll(std::forward<Function>(func));
+  }
+
+ private:
+  void EvictDownTo(std::size_t entries_limit, std::size_t weight_limit) {
+    while (impl_.GetSize() != 0 &&
+           (impl_.GetSize() > entries_limit ||
+            total_weight_ > weight_limit)) {
+      const auto node = impl_.ExtractLeastUsedNode();
+      total_weight_ -= size_of_(node->GetValue());
+    }
+  }
+
+  impl::LruBase<T, U, Hash, Equal> impl_;
+  const std::size_t max_entries_;
+  const std::size_t max_total_weight_;
+  SizeOf size_of_;
+  std::size_t total_weight_{0};
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,30 @@
+#pragma once
+
+/// @file userver/formats/json/binary.hpp
+/// @brief Compact binary encoding of formats::json::Value
+
+#include <string>
+#include <string_view>
+
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+/// @ingroup userver_universal userver_formats
+///
+/// @brief Encodes the document into a compact tagged binary form (little
+/// endian, length-prefixed strings and containers), suitable for cache
+/// dumps and intra-cluster exchange where both sides run userver. The
+/// round-trip skips text JSON entirely: no escaping, no number formatting
+/// or parsing.
+std::string ToBinaryString(const Value& value);
+
+/// @brief Decodes a document produced by ToBinaryString.
+/// @throws std::runtime_error on malformed or truncated input.
+Value FromBinaryString(std::string_view binary);
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
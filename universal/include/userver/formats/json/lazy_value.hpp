@@ -0,0 +1,70 @@
+#pragma once
+
+/// @file userver/formats/json/lazy_value.hpp
+/// @brief @copybrief formats::json::LazyValue
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+/// @ingroup userver_universal userver_formats
+///
+/// @brief A JSON document that defers parsing until first access.
+///
+/// Holds the raw buffer and builds the formats::json::Value tree only when a
+/// field is actually touched, so code paths that pass documents through (or
+/// reject them early) never pay for the parse. All accessors delegate to the
+/// materialized Value, so the Parse/Serialize customization points and
+/// `As<T>()` work unchanged.
+///
+/// Not thread-safe: like ValueBuilder, a LazyValue must not be shared
+/// between tasks.
+class LazyValue final {
+ public:
+  LazyValue() = default;
+
+  explicit LazyValue(std::string raw) : raw_(std::move(raw)) {}
+
+  /// @returns the materialized document, parsing it on first call.
+  /// @throws formats::json::ParseException on malformed input.
+  const Value& operator*() const {
+    if (!parsed_) {
+      parsed_.emplace(FromString(raw_));
+      // the raw buffer is no longer needed
+      std::string{}.swap(raw_);
+    }
+    return *parsed_;
+  }
+
+  const Value* operator->() const { return &**this; }
+
+  /// @see formats::json::Value::operator[]
+  Value operator[](std::string_view key) const { return (**this)[key]; }
+
+  /// @see formats::json::Value::As
+  template <typename T>
+  T As() const {
+    return (**this).template As<T>();
+  }
+
+  /// Whether the document was already materialized.
+  bool IsParsed() const noexcept { return parsed_.has_value(); }
+
+  /// The raw unparsed buffer; empty after materialization.
+  const std::string& GetRawUnparsed() const noexcept { return raw_; }
+
+ private:
+  mutable std::string raw_;
+  mutable std::optional<Value> parsed_;
+};
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
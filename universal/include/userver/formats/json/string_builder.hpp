@@ -87,6 +87,19 @@ class StringBuilder final : public serialize::SaxStream {
   utils::FastPimpl<Impl, 112, 8> impl_;
 };
 
+/// @brief Serializes the value straight into a JSON string through the SAX
+/// WriteToStream machinery: struct to bytes in one pass, without building a
+/// DOM. Nested containers, optionals and variants chain automatically; types
+/// with only a Serialize(To<Value>) customization fall back to a per-subtree
+/// DOM, so implement WriteToStream for the hot types to stay allocation-free
+/// end to end.
+template <typename T>
+std::string ToStringViaStreaming(const T& value) {
+  StringBuilder sw;
+  WriteToStream(value, sw);
+  return sw.GetString();
+}
+
 void WriteToStream(bool value, StringBuilder& sw);
 void WriteToStream(long long value, StringBuilder& sw);
 void WriteToStream(unsigned long long value, StringBuilder& sw);
@@ -112,6 +112,14 @@ class ValueBuilder final {
   /// @throw `TypeMismatchException` if value is not an object.
   void Remove(std::string_view key);
 
+  /// @brief Steals the member's subtree out of this object in O(1), leaving
+  /// null under the key; returns a null builder if the key is missing.
+  /// Together with the stealing `ValueBuilder(Value&&)` constructor and
+  /// `EmplaceNocheck` this allows patching large uniquely-owned documents
+  /// with O(change) work instead of copy-modify of the whole tree.
+  /// @throw `TypeMismatchException` if value is not an object.
+  ValueBuilder ExtractMember(std::string_view key);
+
   iterator begin();
   iterator end();
 
@@ -0,0 +1,59 @@
+#pragma once
+
+/// @file userver/fs/blocking/mmap_file.hpp
+/// @brief @copybrief fs::blocking::MmapFile
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <userver/utils/fast_pimpl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs::blocking {
+
+/// @ingroup userver_universal
+///
+/// @brief A read-only memory mapping of a file.
+///
+/// Pages are faulted in lazily by the kernel and shared across processes
+/// mapping the same file, so huge files (models, dictionaries) can be
+/// "read" without copying them into anonymous memory. Accessing the
+/// mapping may fault pages in, which blocks the thread: open the file and
+/// touch cold ranges on an fs task processor.
+class MmapFile final {
+ public:
+  /// Page-in strategy, see madvise(2)
+  enum class Advice {
+    kNormal,      ///< default kernel readahead
+    kSequential,  ///< aggressive readahead, drop-behind
+    kRandom,      ///< disable readahead
+    kWillNeed,    ///< start asynchronous read-ahead of the whole file
+  };
+
+  /// @brief Maps the whole file read-only.
+  /// @throws std::runtime_error on filesystem or mmap errors.
+  explicit MmapFile(const std::string& path, Advice advice = Advice::kNormal);
+
+  MmapFile(MmapFile&&) noexcept;
+  MmapFile& operator=(MmapFile&&) noexcept;
+  ~MmapFile();
+
+  /// The mapped contents; valid while this object is alive.
+  std::string_view GetContents() const noexcept;
+
+  std::size_t GetSize() const noexcept;
+
+  /// @brief Hints the kernel that the pages are not needed anymore
+  /// (madvise(MADV_DONTNEED)); subsequent access faults them back in.
+  void EvictPages() noexcept;
+
+ private:
+  struct Impl;
+  utils::FastPimpl<Impl, 24, 8> impl_;
+};
+
+}  // namespace fs::blocking
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,35 @@
+#pragma once
+
+/// @file userver/utils/numconv.hpp
+/// @brief Fast buffer-based number-to-string kernels.
+/// @ingroup userver_universal
+
+#include <cstddef>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief Shared fast number formatting for serialization, logging and
+/// statistics rendering. Integers go through branch-light two-digit-pair
+/// emission, doubles through a Dragonbox-class shortest-representation
+/// algorithm (both via fmt's kernels), writing straight into caller
+/// buffers with no allocations or locale machinery.
+namespace utils::numconv {
+
+/// Enough for any value of the corresponding overloads, including the sign.
+inline constexpr std::size_t kMaxIntegerChars = 24;
+inline constexpr std::size_t kMaxDoubleChars = 32;
+
+/// @brief Writes the decimal representation into `buffer` (which must hold
+/// at least kMaxIntegerChars/kMaxDoubleChars bytes, no terminating zero is
+/// written).
+/// @returns the number of characters written.
+std::size_t ToChars(std::int64_t value, char* buffer) noexcept;
+std::size_t ToChars(std::uint64_t value, char* buffer) noexcept;
+
+/// Shortest round-trippable representation.
+std::size_t ToChars(double value, char* buffer) noexcept;
+
+}  // namespace utils::numconv
+
+USERVER_NAMESPACE_END
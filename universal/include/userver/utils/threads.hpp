@@ -4,6 +4,9 @@
 /// @brief Functions to work with OS threads.
 /// @ingroup userver_universal
 
+#include <cstddef>
+#include <vector>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils {
@@ -19,6 +22,24 @@ void SetCurrentThreadIdleScheduling();
 /// @throws std::system_error
 void SetCurrentThreadLowPriorityScheduling();
 
+/// @brief Pin the current OS thread to the CPUs of the given NUMA node and
+/// remember the node for NUMA-aware pooling. Does nothing on platforms
+/// without NUMA support.
+/// @throws std::system_error, std::runtime_error
+void SetCurrentThreadNumaNode(int node);
+
+/// @returns the NUMA node previously set for this thread via
+/// SetCurrentThreadNumaNode, or 0 if the thread was not pinned
+int GetCurrentThreadNumaNode() noexcept;
+
+/// @returns the number of NUMA nodes in the system, 1 if undetectable
+std::size_t GetNumaNodeCount() noexcept;
+
+/// @brief Pin the current OS thread to the given CPU set. Does nothing on
+/// platforms without sched_setaffinity.
+/// @throws std::system_error
+void SetCurrentThreadCpuAffinity(const std::vector<int>& cpus);
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
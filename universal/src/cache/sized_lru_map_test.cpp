@@ -0,0 +1,86 @@
+#include <userver/cache/sized_lru_map.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct StringSize final {
+  std::size_t operator()(const std::string& value) const noexcept {
+    return value.size();
+  }
+};
+
+using Cache = cache::SizedLruMap<int, std::string, StringSize>;
+
+}  // namespace
+
+TEST(SizedLruMap, WeightedEviction) {
+  Cache cache{100, 10};
+
+  EXPECT_TRUE(cache.Put(1, "aaaa"));  // 4 bytes
+  EXPECT_TRUE(cache.Put(2, "bbbb"));  // 8 total
+  EXPECT_EQ(cache.GetTotalWeight(), 8);
+
+  // 4 more bytes exceed the budget: the least-used entry (1) is evicted
+  EXPECT_TRUE(cache.Put(3, "cccc"));
+  EXPECT_EQ(cache.Get(1), nullptr);
+  ASSERT_NE(cache.Get(2), nullptr);
+  EXPECT_EQ(cache.GetTotalWeight(), 8);
+}
+
+TEST(SizedLruMap, HeavyEntryRejected) {
+  Cache cache{100, 10};
+  cache.Put(1, "aaaa");
+
+  EXPECT_FALSE(cache.Put(2, std::string(11, 'x')));
+  // the cache was not flushed for the oversized entry
+  EXPECT_NE(cache.Get(1), nullptr);
+  EXPECT_EQ(cache.GetTotalWeight(), 4);
+}
+
+TEST(SizedLruMap, ReplaceAdjustsWeight) {
+  Cache cache{100, 10};
+  cache.Put(1, "aaaa");
+  cache.Put(1, "bb");
+  EXPECT_EQ(cache.GetTotalWeight(), 2);
+  EXPECT_EQ(*cache.Get(1), "bb");
+
+  // replacing with a near-budget value evicts everything else but the key
+  cache.Put(2, "cc");
+  cache.Put(1, std::string(10, 'z'));
+  EXPECT_EQ(cache.GetTotalWeight(), 10);
+  EXPECT_EQ(cache.Get(2), nullptr);
+  ASSERT_NE(cache.Get(1), nullptr);
+}
+
+TEST(SizedLruMap, EntryCountLimitStillHolds) {
+  Cache cache{2, 1000};
+  cache.Put(1, "a");
+  cache.Put(2, "b");
+  cache.Put(3, "c");
+
+  EXPECT_EQ(cache.GetSize(), 2);
+  EXPECT_EQ(cache.Get(1), nullptr);
+  EXPECT_EQ(cache.GetTotalWeight(), 2);
+}
+
+TEST(SizedLruMap, EraseAndClear) {
+  Cache cache{10, 100};
+  cache.Put(1, "aaaa");
+  cache.Put(2, "bb");
+
+  cache.Erase(1);
+  EXPECT_EQ(cache.GetTotalWeight(), 2);
+  cache.Erase(1);  // idempotent
+  EXPECT_EQ(cache.GetTotalWeight(), 2);
+
+  cache.Clear();
+  EXPECT_EQ(cache.GetTotalWeight(), 0);
+  EXPECT_EQ(cache.GetSize(), 0);
+}
+
+USERVER_NAMESPACE_END
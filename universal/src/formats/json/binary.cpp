@@ -0,0 +1,178 @@
+#include <userver/formats/json/binary.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include <userver/formats/json/iterator.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace {
+
+enum class Tag : std::uint8_t {
+  kNull = 0,
+  kFalse = 1,
+  kTrue = 2,
+  kInt64 = 3,
+  kUInt64 = 4,
+  kDouble = 5,
+  kString = 6,
+  kArray = 7,
+  kObject = 8,
+};
+
+// Nesting depth sanity bound for decoding untrusted dumps
+constexpr std::size_t kMaxDepth = 128;
+
+template <typename T>
+void AppendRaw(std::string& out, T value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  char buffer[sizeof(T)];
+  std::memcpy(buffer, &value, sizeof(T));
+  out.append(buffer, sizeof(T));
+}
+
+void AppendTag(std::string& out, Tag tag) {
+  out.push_back(static_cast<char>(tag));
+}
+
+void AppendString(std::string& out, std::string_view str) {
+  AppendRaw(out, static_cast<std::uint32_t>(str.size()));
+  out.append(str);
+}
+
+void WriteValue(std::string& out, const Value& value) {
+  if (value.IsNull()) {
+    AppendTag(out, Tag::kNull);
+  } else if (value.IsBool()) {
+    AppendTag(out, value.As<bool>() ? Tag::kTrue : Tag::kFalse);
+  } else if (value.IsInt64()) {
+    AppendTag(out, Tag::kInt64);
+    AppendRaw(out, value.As<std::int64_t>());
+  } else if (value.IsUInt64()) {
+    AppendTag(out, Tag::kUInt64);
+    AppendRaw(out, value.As<std::uint64_t>());
+  } else if (value.IsDouble()) {
+    AppendTag(out, Tag::kDouble);
+    AppendRaw(out, value.As<double>());
+  } else if (value.IsString()) {
+    AppendTag(out, Tag::kString);
+    AppendString(out, value.As<std::string>());
+  } else if (value.IsArray()) {
+    AppendTag(out, Tag::kArray);
+    AppendRaw(out, static_cast<std::uint32_t>(value.GetSize()));
+    for (const auto& item : value) {
+      WriteValue(out, item);
+    }
+  } else {
+    AppendTag(out, Tag::kObject);
+    AppendRaw(out, static_cast<std::uint32_t>(value.GetSize()));
+    for (auto it = value.begin(); it != value.end(); ++it) {
+      AppendString(out, it.GetName());
+      WriteValue(out, *it);
+    }
+  }
+}
+
+class Reader final {
+ public:
+  explicit Reader(std::string_view data) : data_(data) {}
+
+  Value ReadDocument() {
+    auto result = ReadValue(0).ExtractValue();
+    if (!data_.empty()) {
+      throw std::runtime_error(
+          "formats::json::FromBinaryString: trailing bytes");
+    }
+    return result;
+  }
+
+ private:
+  template <typename T>
+  T ReadRaw() {
+    if (data_.size() < sizeof(T)) {
+      throw std::runtime_error(
+          "formats::json::FromBinaryString: truncated input");
+    }
+    T value{};
+    std::memcpy(&value, data_.data(), sizeof(T));
+    data_.remove_prefix(sizeof(T));
+    return value;
+  }
+
+  std::string_view ReadString() {
+    const auto size = ReadRaw<std::uint32_t>();
+    if (data_.size() < size) {
+      throw std::runtime_error(
+          "formats::json::FromBinaryString: truncated string");
+    }
+    const auto result = data_.substr(0, size);
+    data_.remove_prefix(size);
+    return result;
+  }
+
+  ValueBuilder ReadValue(std::size_t depth) {
+    if (depth > kMaxDepth) {
+      throw std::runtime_error(
+          "formats::json::FromBinaryString: document is too deep");
+    }
+
+    const auto tag = static_cast<Tag>(ReadRaw<std::uint8_t>());
+    switch (tag) {
+      case Tag::kNull:
+        return ValueBuilder{};
+      case Tag::kFalse:
+        return ValueBuilder{false};
+      case Tag::kTrue:
+        return ValueBuilder{true};
+      case Tag::kInt64:
+        return ValueBuilder{ReadRaw<std::int64_t>()};
+      case Tag::kUInt64:
+        return ValueBuilder{ReadRaw<std::uint64_t>()};
+      case Tag::kDouble:
+        return ValueBuilder{ReadRaw<double>()};
+      case Tag::kString:
+        return ValueBuilder{std::string{ReadString()}};
+      case Tag::kArray: {
+        const auto size = ReadRaw<std::uint32_t>();
+        ValueBuilder builder{formats::common::Type::kArray};
+        for (std::uint32_t i = 0; i < size; ++i) {
+          builder.PushBack(ReadValue(depth + 1).ExtractValue());
+        }
+        return builder;
+      }
+      case Tag::kObject: {
+        const auto size = ReadRaw<std::uint32_t>();
+        ValueBuilder builder{formats::common::Type::kObject};
+        for (std::uint32_t i = 0; i < size; ++i) {
+          const auto key = std::string{ReadString()};
+          builder[key] = ReadValue(depth + 1).ExtractValue();
+        }
+        return builder;
+      }
+    }
+    throw std::runtime_error("formats::json::FromBinaryString: unknown tag");
+  }
+
+  std::string_view data_;
+};
+
+}  // namespace
+
+std::string ToBinaryString(const Value& value) {
+  std::string result;
+  WriteValue(result, value);
+  return result;
+}
+
+Value FromBinaryString(std::string_view binary) {
+  return Reader{binary}.ReadDocument();
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#include <userver/formats/json/binary.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void CheckRoundtrip(std::string_view json) {
+  const auto original = formats::json::FromString(json);
+  const auto binary = formats::json::ToBinaryString(original);
+  const auto restored = formats::json::FromBinaryString(binary);
+  EXPECT_EQ(original, restored) << "json=" << json;
+}
+
+}  // namespace
+
+TEST(JsonBinary, Roundtrip) {
+  CheckRoundtrip("null");
+  CheckRoundtrip("true");
+  CheckRoundtrip("false");
+  CheckRoundtrip("42");
+  CheckRoundtrip("-9223372036854775808");
+  CheckRoundtrip("18446744073709551615");
+  CheckRoundtrip("1.5");
+  CheckRoundtrip(R"("string with \"quotes\" and ü")");
+  CheckRoundtrip("[]");
+  CheckRoundtrip("{}");
+  CheckRoundtrip(R"([1, "two", 3.5, null, true, [2], {"k": "v"}])");
+  CheckRoundtrip(
+      R"({"user": {"id": 17, "name": "x"}, "items": [1, 2, 3], "ok": true})");
+}
+
+TEST(JsonBinary, TruncatedInputThrows) {
+  const auto original = formats::json::FromString(R"({"key": "value"})");
+  const auto binary = formats::json::ToBinaryString(original);
+
+  for (std::size_t cut = 1; cut < binary.size(); ++cut) {
+    UEXPECT_THROW(formats::json::FromBinaryString(
+                      std::string_view{binary}.substr(0, cut)),
+                  std::runtime_error);
+  }
+}
+
+TEST(JsonBinary, TrailingBytesThrow) {
+  auto binary = formats::json::ToBinaryString(formats::json::FromString("1"));
+  binary += '\0';
+  UEXPECT_THROW(formats::json::FromBinaryString(binary), std::runtime_error);
+}
+
+TEST(JsonBinary, UnknownTagThrows) {
+  UEXPECT_THROW(formats::json::FromBinaryString("\x2a"), std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,42 @@
+#include <userver/formats/json/lazy_value.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(JsonLazyValue, ParsesOnFirstAccess) {
+  formats::json::LazyValue value{R"({"key": 42, "other": "text"})"};
+  EXPECT_FALSE(value.IsParsed());
+  EXPECT_FALSE(value.GetRawUnparsed().empty());
+
+  EXPECT_EQ(value["key"].As<int>(), 42);
+  EXPECT_TRUE(value.IsParsed());
+  EXPECT_TRUE(value.GetRawUnparsed().empty());
+
+  EXPECT_EQ(value["other"].As<std::string>(), "text");
+}
+
+TEST(JsonLazyValue, PassThroughNeverParses) {
+  const formats::json::LazyValue value{R"({"huge": "document"})"};
+  EXPECT_EQ(value.GetRawUnparsed(), R"({"huge": "document"})");
+  EXPECT_FALSE(value.IsParsed());
+}
+
+TEST(JsonLazyValue, MalformedThrowsOnAccess) {
+  formats::json::LazyValue value{"{broken"};
+  EXPECT_FALSE(value.IsParsed());
+  UEXPECT_THROW(value["key"], formats::json::ParseException);
+}
+
+TEST(JsonLazyValue, AsWholeDocument) {
+  formats::json::LazyValue value{"[1, 2, 3]"};
+  const auto numbers = value.As<std::vector<int>>();
+  ASSERT_EQ(numbers.size(), 3);
+  EXPECT_EQ(numbers[2], 3);
+}
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <benchmark/benchmark.h>
 
 #include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/lazy_value.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value_builder.hpp>
 
@@ -190,4 +191,22 @@ BENCHMARK(json_object_wide_object_operator_equals)
     ->Range(32, 8192)
     ->RangeMultiplier(2);
 
+void json_lazy_value_pass_through(benchmark::State& state) {
+  // The pass-through case LazyValue optimizes: the document is moved around
+  // but never inspected, so it is never parsed.
+  for ([[maybe_unused]] auto _ : state) {
+    formats::json::LazyValue value{std::string{bench_json_data}};
+    benchmark::DoNotOptimize(value.GetRawUnparsed());
+  }
+}
+BENCHMARK(json_lazy_value_pass_through);
+
+void json_lazy_value_eager_baseline(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    const auto value = formats::json::FromString(bench_json_data);
+    benchmark::DoNotOptimize(value);
+  }
+}
+BENCHMARK(json_lazy_value_eager_baseline);
+
 USERVER_NAMESPACE_END
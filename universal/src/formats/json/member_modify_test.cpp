@@ -54,4 +54,36 @@ struct MemberModify<formats::json::ValueBuilder> : public ::testing::Test {
 INSTANTIATE_TYPED_TEST_SUITE_P(FormatsJson, MemberModify,
                                formats::json::ValueBuilder);
 
+TEST(JsonMemberModify, ExtractMemberSteals) {
+  formats::json::ValueBuilder builder{
+      formats::json::FromString(R"({"keep": 1, "take": {"big": [1, 2, 3]}})")};
+
+  auto taken = builder.ExtractMember("take");
+  EXPECT_EQ(taken.ExtractValue()["big"][2].As<int>(), 3);
+
+  const auto rest = builder.ExtractValue();
+  EXPECT_EQ(rest["keep"].As<int>(), 1);
+  EXPECT_TRUE(rest["take"].IsNull());
+}
+
+TEST(JsonMemberModify, ExtractMemberMissing) {
+  formats::json::ValueBuilder builder{formats::common::Type::kObject};
+  auto taken = builder.ExtractMember("absent");
+  EXPECT_TRUE(taken.ExtractValue().IsNull());
+}
+
+TEST(JsonMemberModify, PatchInPlace) {
+  // O(change) patch of a uniquely-owned document: steal the tree into a
+  // builder, replace one field, move the tree back out.
+  auto document =
+      formats::json::FromString(R"({"config": {"a": 1}, "version": 1})");
+
+  formats::json::ValueBuilder builder{std::move(document)};
+  builder["version"] = 2;
+  const auto patched = builder.ExtractValue();
+
+  EXPECT_EQ(patched["version"].As<int>(), 2);
+  EXPECT_EQ(patched["config"]["a"].As<int>(), 1);
+}
+
 USERVER_NAMESPACE_END
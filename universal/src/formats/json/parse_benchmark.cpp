@@ -0,0 +1,80 @@
+#include <userver/formats/json/serialize.hpp>
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Parsing throughput suite; bytes/sec is the interesting number, so the
+// payloads are sized via the benchmark argument. Build with
+// USERVER_FEATURE_JSON_SIMD=ON to measure the vectorized rapidjson kernels.
+
+std::string MakeFlatObject(std::size_t field_count) {
+  std::string result = "{";
+  for (std::size_t i = 0; i < field_count; ++i) {
+    if (i != 0) result += ',';
+    result += "\"field_with_a_long_name_" + std::to_string(i) +
+              "\": \"value value value value " + std::to_string(i) + '"';
+  }
+  result += '}';
+  return result;
+}
+
+std::string MakeNestedArrays(std::size_t element_count) {
+  std::string result = "[";
+  for (std::size_t i = 0; i < element_count; ++i) {
+    if (i != 0) result += ',';
+    result += "[1, 2.5, -17, \"short\", true, null, " + std::to_string(i) +
+              ']';
+  }
+  result += ']';
+  return result;
+}
+
+void json_parse_flat_object(benchmark::State& state) {
+  const auto payload =
+      MakeFlatObject(static_cast<std::size_t>(state.range(0)));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto value = formats::json::FromString(payload);
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(payload.size()));
+}
+BENCHMARK(json_parse_flat_object)->Arg(8)->Arg(64)->Arg(512);
+
+void json_parse_nested_arrays(benchmark::State& state) {
+  const auto payload =
+      MakeNestedArrays(static_cast<std::size_t>(state.range(0)));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto value = formats::json::FromString(payload);
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(payload.size()));
+}
+BENCHMARK(json_parse_nested_arrays)->Arg(8)->Arg(64)->Arg(512);
+
+void json_parse_long_strings(benchmark::State& state) {
+  const std::string payload = "{\"data\": \"" +
+                              std::string(static_cast<std::size_t>(
+                                              state.range(0)),
+                                          'x') +
+                              "\"}";
+  for ([[maybe_unused]] auto _ : state) {
+    const auto value = formats::json::FromString(payload);
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(payload.size()));
+}
+BENCHMARK(json_parse_long_strings)->Arg(1024)->Arg(65536);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
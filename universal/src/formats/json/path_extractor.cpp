@@ -0,0 +1,69 @@
+#include <userver/formats/json/path_extractor.hpp>
+
+#include <stdexcept>
+
+#include <userver/formats/json/iterator.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+PathExtractor::PathExtractor(const std::vector<std::string>& paths)
+    : paths_count_(paths.size()) {
+  for (std::size_t index = 0; index < paths.size(); ++index) {
+    const auto& path = paths[index];
+    if (path.empty() || path.front() != '/') {
+      throw std::runtime_error(
+          "PathExtractor: path must start with '/', got '" + path + '\'');
+    }
+
+    Node* node = &root_;
+    std::size_t pos = 1;
+    while (pos <= path.size()) {
+      const auto next_slash = path.find('/', pos);
+      const auto segment =
+          path.substr(pos, next_slash == std::string::npos
+                               ? std::string::npos
+                               : next_slash - pos);
+      if (segment.empty()) {
+        throw std::runtime_error("PathExtractor: empty segment in '" + path +
+                                 '\'');
+      }
+      node = &node->children[segment];
+      if (next_slash == std::string::npos) break;
+      pos = next_slash + 1;
+    }
+
+    if (node->output_index) {
+      throw std::runtime_error("PathExtractor: duplicate path '" + path +
+                               '\'');
+    }
+    node->output_index = index;
+  }
+}
+
+std::vector<Value> PathExtractor::Extract(const Value& document) const {
+  std::vector<Value> outputs(paths_count_);
+  Visit(document, root_, outputs);
+  return outputs;
+}
+
+void PathExtractor::Visit(const Value& value, const Node& node,
+                         std::vector<Value>& outputs) {
+  if (node.output_index) {
+    outputs[*node.output_index] = value;
+  }
+  if (node.children.empty() || !value.IsObject()) return;
+
+  // One iteration over the object serves every path that goes through it
+  for (auto it = value.begin(); it != value.end(); ++it) {
+    const auto child = node.children.find(it.GetName());
+    if (child != node.children.end()) {
+      Visit(*it, child->second, outputs);
+    }
+  }
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#include <userver/formats/json/path_extractor.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(JsonPathExtractor, SinglePassExtraction) {
+  /// [Sample PathExtractor usage]
+  const formats::json::PathExtractor extractor{{
+      "/payload/user/id",
+      "/payload/user/name",
+      "/meta/trace_id",
+  }};
+
+  const auto document = formats::json::FromString(R"({
+    "payload": {"user": {"id": 42, "name": "alice"}, "extra": [1, 2]},
+    "meta": {"trace_id": "abc"},
+    "unrelated": {"huge": "subtree"}
+  })");
+
+  const auto values = extractor.Extract(document);
+  EXPECT_EQ(values[0].As<int>(), 42);
+  EXPECT_EQ(values[1].As<std::string>(), "alice");
+  EXPECT_EQ(values[2].As<std::string>(), "abc");
+  /// [Sample PathExtractor usage]
+}
+
+TEST(JsonPathExtractor, MissingPaths) {
+  const formats::json::PathExtractor extractor{{"/a/b", "/a/c"}};
+  const auto document = formats::json::FromString(R"({"a": {"b": 1}})");
+
+  const auto values = extractor.Extract(document);
+  EXPECT_EQ(values[0].As<int>(), 1);
+  EXPECT_TRUE(values[1].IsNull());
+}
+
+TEST(JsonPathExtractor, WholeSubtree) {
+  const formats::json::PathExtractor extractor{{"/a"}};
+  const auto document =
+      formats::json::FromString(R"({"a": {"nested": [1, 2]}})");
+
+  const auto values = extractor.Extract(document);
+  EXPECT_TRUE(values[0].IsObject());
+  EXPECT_EQ(values[0]["nested"][1].As<int>(), 2);
+}
+
+TEST(JsonPathExtractor, BadPathsThrow) {
+  UEXPECT_THROW(formats::json::PathExtractor{{"no-slash"}},
+                std::runtime_error);
+  UEXPECT_THROW(formats::json::PathExtractor{{"/a//b"}}, std::runtime_error);
+  UEXPECT_THROW((formats::json::PathExtractor{{"/a", "/a"}}),
+                std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
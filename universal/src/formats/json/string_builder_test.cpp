@@ -347,4 +347,43 @@ TEST(JsonStringBuilder, ExampleUsage) {
 }  // namespace my_namespace
 /// [Sample formats::json::StringBuilder usage]
 
+namespace streaming_test {
+
+struct Inner {
+  int number{};
+};
+
+void WriteToStream(const Inner& value, formats::json::StringBuilder& sw) {
+  const formats::json::StringBuilder::ObjectGuard guard{sw};
+  sw.Key("number");
+  sw.WriteInt64(value.number);
+}
+
+struct Outer {
+  std::string name;
+  std::vector<Inner> items;
+};
+
+void WriteToStream(const Outer& value, formats::json::StringBuilder& sw) {
+  const formats::json::StringBuilder::ObjectGuard guard{sw};
+  sw.Key("name");
+  sw.WriteString(value.name);
+  sw.Key("items");
+  WriteToStream(value.items, sw);
+}
+
+}  // namespace streaming_test
+
+TEST(JsonStringBuilder, ToStringViaStreaming) {
+  const streaming_test::Outer value{"test", {{1}, {2}}};
+  EXPECT_EQ(formats::json::ToStringViaStreaming(value),
+            R"({"name":"test","items":[{"number":1},{"number":2}]})");
+}
+
+TEST(JsonStringBuilder, ToStringViaStreamingContainers) {
+  // containers chain through the generic WriteToStream machinery
+  const std::vector<std::optional<int>> values{1, std::nullopt, 3};
+  EXPECT_EQ(formats::json::ToStringViaStreaming(values), "[1,null,3]");
+}
+
 USERVER_NAMESPACE_END
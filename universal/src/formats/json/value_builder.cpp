@@ -149,6 +149,19 @@ void ValueBuilder::EmplaceNocheck(std::string_view key, ValueBuilder value) {
   Move(AddMember(key, CheckMemberExists::kNo), std::move(value));
 }
 
+ValueBuilder ValueBuilder::ExtractMember(std::string_view key) {
+  value_->CheckObject();
+  auto& native = value_->GetNative();
+  const auto it = native.FindMember(impl::MakeJsonStringViewValue(key));
+  if (it == native.MemberEnd()) return ValueBuilder{};
+
+  ValueBuilder result;
+  // rapidjson assignment is a move that leaves null behind
+  result.value_->GetNative() = std::move(it->value);
+  value_.OnMembersChange();
+  return result;
+}
+
 void ValueBuilder::Remove(std::string_view key) {
   value_->CheckObject();
   if (value_->GetNative().RemoveMember(impl::MakeJsonStringViewValue(key))) {
@@ -0,0 +1,103 @@
+#include <userver/fs/blocking/mmap_file.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs::blocking {
+
+namespace {
+
+int ToMadvise(MmapFile::Advice advice) noexcept {
+  switch (advice) {
+    case MmapFile::Advice::kNormal:
+      return MADV_NORMAL;
+    case MmapFile::Advice::kSequential:
+      return MADV_SEQUENTIAL;
+    case MmapFile::Advice::kRandom:
+      return MADV_RANDOM;
+    case MmapFile::Advice::kWillNeed:
+      return MADV_WILLNEED;
+  }
+  return MADV_NORMAL;
+}
+
+}  // namespace
+
+struct MmapFile::Impl {
+  void* data{nullptr};
+  std::size_t size{0};
+};
+
+MmapFile::MmapFile(const std::string& path, Advice advice) {
+  const int fd = utils::CheckSyscall(
+      ::open(path.c_str(), O_RDONLY | O_CLOEXEC), "opening '{}'", path);
+
+  struct ::stat file_stat {};
+  try {
+    utils::CheckSyscall(::fstat(fd, &file_stat), "stat of '{}'", path);
+
+    impl_->size = static_cast<std::size_t>(file_stat.st_size);
+    if (impl_->size != 0) {
+      void* const mapping =
+          ::mmap(nullptr, impl_->size, PROT_READ, MAP_SHARED, fd, 0);
+      if (mapping == MAP_FAILED) {
+        utils::CheckSyscall(-1, "mmap of '{}'", path);
+      }
+      impl_->data = mapping;
+
+      if (advice != Advice::kNormal) {
+        // advisory only, failures are not fatal
+        ::madvise(impl_->data, impl_->size, ToMadvise(advice));
+      }
+    }
+  } catch (...) {
+    ::close(fd);
+    throw;
+  }
+  // the mapping keeps the file referenced
+  ::close(fd);
+}
+
+MmapFile::MmapFile(MmapFile&& other) noexcept
+    : impl_(std::move(other.impl_)) {
+  other.impl_->data = nullptr;
+  other.impl_->size = 0;
+}
+
+MmapFile& MmapFile::operator=(MmapFile&& other) noexcept {
+  if (this != &other) {
+    if (impl_->data) ::munmap(impl_->data, impl_->size);
+    impl_->data = std::exchange(other.impl_->data, nullptr);
+    impl_->size = std::exchange(other.impl_->size, 0);
+  }
+  return *this;
+}
+
+MmapFile::~MmapFile() {
+  if (impl_->data) ::munmap(impl_->data, impl_->size);
+}
+
+std::string_view MmapFile::GetContents() const noexcept {
+  return {static_cast<const char*>(impl_->data), impl_->size};
+}
+
+std::size_t MmapFile::GetSize() const noexcept { return impl_->size; }
+
+void MmapFile::EvictPages() noexcept {
+  if (impl_->data) ::madvise(impl_->data, impl_->size, MADV_DONTNEED);
+}
+
+}  // namespace fs::blocking
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,55 @@
+#include <userver/fs/blocking/mmap_file.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(MmapFile, MapsContents) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), "mapped contents");
+
+  const fs::blocking::MmapFile mapping{file.GetPath()};
+  EXPECT_EQ(mapping.GetSize(), 15);
+  EXPECT_EQ(mapping.GetContents(), "mapped contents");
+}
+
+TEST(MmapFile, EmptyFile) {
+  const auto file = fs::blocking::TempFile::Create();
+
+  const fs::blocking::MmapFile mapping{file.GetPath()};
+  EXPECT_EQ(mapping.GetSize(), 0);
+  EXPECT_EQ(mapping.GetContents(), "");
+}
+
+TEST(MmapFile, AdviceAndEvict) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), std::string(1 << 16, 'x'));
+
+  fs::blocking::MmapFile mapping{file.GetPath(),
+                                 fs::blocking::MmapFile::Advice::kSequential};
+  EXPECT_EQ(mapping.GetContents().front(), 'x');
+
+  mapping.EvictPages();
+  // pages fault back in transparently
+  EXPECT_EQ(mapping.GetContents().back(), 'x');
+}
+
+TEST(MmapFile, MoveTransfersOwnership) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), "abc");
+
+  fs::blocking::MmapFile first{file.GetPath()};
+  const fs::blocking::MmapFile second{std::move(first)};
+  EXPECT_EQ(second.GetContents(), "abc");
+}
+
+TEST(MmapFile, MissingFileThrows) {
+  UEXPECT_THROW(fs::blocking::MmapFile{"/nonexistent/path/for/sure"},
+                std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -147,7 +147,10 @@ StaticLogEntry::StaticLogEntry(const char* path, int line) noexcept {
 bool StaticLogEntry::ShouldNotLog(logging::LoggerRef logger,
                                   logging::Level level) const noexcept {
   const auto& content = reinterpret_cast<const LogEntryContent&>(content_);
-  const auto state = content.state.load();
+  // Hot path of every LOG_* statement: the state is a config flag with no
+  // ordering dependencies, a relaxed load avoids the fence on weakly
+  // ordered architectures.
+  const auto state = content.state.load(std::memory_order_relaxed);
   const bool force_disabled = level < state.force_disabled_level_plus_one;
   const bool force_enabled =
       level >= state.force_enabled_level && level != logging::Level::kNone;
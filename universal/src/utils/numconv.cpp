@@ -0,0 +1,34 @@
+#include <userver/utils/numconv.hpp>
+
+#include <cstring>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::numconv {
+
+std::size_t ToChars(std::int64_t value, char* buffer) noexcept {
+  // fmt::format_int is the branch-light two-digit-pair kernel
+  const fmt::format_int formatted{value};
+  std::memcpy(buffer, formatted.data(), formatted.size());
+  return formatted.size();
+}
+
+std::size_t ToChars(std::uint64_t value, char* buffer) noexcept {
+  const fmt::format_int formatted{value};
+  std::memcpy(buffer, formatted.data(), formatted.size());
+  return formatted.size();
+}
+
+std::size_t ToChars(double value, char* buffer) noexcept {
+  // fmt's default double formatting is the shortest round-trippable
+  // representation via a Dragonbox-class algorithm
+  const auto* const end = fmt::format_to(buffer, FMT_COMPILE("{}"), value);
+  return static_cast<std::size_t>(end - buffer);
+}
+
+}  // namespace utils::numconv
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,57 @@
+#include <userver/utils/numconv.hpp>
+
+#include <cstdio>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void numconv_int64(benchmark::State& state) {
+  std::int64_t value = 1234567890123;
+  char buffer[utils::numconv::kMaxIntegerChars];
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::numconv::ToChars(value, buffer));
+    ++value;
+  }
+}
+BENCHMARK(numconv_int64);
+
+void numconv_int64_snprintf_baseline(benchmark::State& state) {
+  std::int64_t value = 1234567890123;
+  char buffer[32];
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        std::snprintf(buffer, sizeof(buffer), "%lld",
+                      static_cast<long long>(value)));
+    ++value;
+  }
+}
+BENCHMARK(numconv_int64_snprintf_baseline);
+
+void numconv_double(benchmark::State& state) {
+  double value = 0.12345;
+  char buffer[utils::numconv::kMaxDoubleChars];
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::numconv::ToChars(value, buffer));
+    value += 0.1;
+  }
+}
+BENCHMARK(numconv_double);
+
+void numconv_double_snprintf_baseline(benchmark::State& state) {
+  double value = 0.12345;
+  char buffer[64];
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        std::snprintf(buffer, sizeof(buffer), "%.17g", value));
+    value += 0.1;
+  }
+}
+BENCHMARK(numconv_double_snprintf_baseline);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
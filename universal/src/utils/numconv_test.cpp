@@ -0,0 +1,41 @@
+#include <userver/utils/numconv.hpp>
+
+#include <limits>
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename T>
+std::string Convert(T value) {
+  char buffer[utils::numconv::kMaxDoubleChars]{};
+  const auto size = utils::numconv::ToChars(value, buffer);
+  return std::string{buffer, size};
+}
+
+}  // namespace
+
+TEST(NumConv, Integers) {
+  EXPECT_EQ(Convert(std::int64_t{0}), "0");
+  EXPECT_EQ(Convert(std::int64_t{-1}), "-1");
+  EXPECT_EQ(Convert(std::int64_t{1234567890}), "1234567890");
+  EXPECT_EQ(Convert(std::numeric_limits<std::int64_t>::min()),
+            "-9223372036854775808");
+  EXPECT_EQ(Convert(std::numeric_limits<std::uint64_t>::max()),
+            "18446744073709551615");
+}
+
+TEST(NumConv, Doubles) {
+  EXPECT_EQ(Convert(0.0), "0");
+  EXPECT_EQ(Convert(1.5), "1.5");
+  EXPECT_EQ(Convert(-2.25), "-2.25");
+
+  // shortest representation must round-trip
+  const double value = 0.1 + 0.2;
+  EXPECT_EQ(std::stod(Convert(value)), value);
+}
+
+USERVER_NAMESPACE_END
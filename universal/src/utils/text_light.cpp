@@ -1,6 +1,8 @@
 #include <userver/utils/text_light.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <unordered_map>
@@ -238,7 +240,21 @@ bool IsWellFormedCodePoint(const unsigned char* bytes,
 }
 
 bool IsValid(const unsigned char* bytes, std::size_t length) noexcept {
-  for (size_t i = 0; i < length; ++i) {
+  std::size_t i = 0;
+
+  // ASCII fast path: consume word-sized chunks while the high bits are
+  // clear. The loop compiles to vector compares on the usual targets; the
+  // first chunk with a non-ASCII byte falls through to the per-code-point
+  // validation (all bytes before it are whole one-byte code points).
+  constexpr std::uint64_t kHighBits = 0x8080808080808080ULL;
+  while (i + sizeof(std::uint64_t) <= length) {
+    std::uint64_t word{};
+    std::memcpy(&word, bytes + i, sizeof(word));
+    if (word & kHighBits) break;
+    i += sizeof(word);
+  }
+
+  for (; i < length; ++i) {
     if (!IsWellFormedCodePoint(bytes + i, length - i)) {
       return false;
     } else {
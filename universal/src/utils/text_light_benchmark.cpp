@@ -0,0 +1,41 @@
+#include <userver/utils/text_light.hpp>
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// IsUtf8 sits on the logging and serialization hot paths; bytes/sec is the
+// interesting number. The ASCII case takes the word-at-a-time fast path,
+// the mixed case exercises the per-code-point validation.
+
+void utf8_validate_ascii(benchmark::State& state) {
+  const std::string payload(static_cast<std::size_t>(state.range(0)), 'a');
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::text::IsUtf8(payload));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(payload.size()));
+}
+BENCHMARK(utf8_validate_ascii)->Arg(64)->Arg(4096)->Arg(65536);
+
+void utf8_validate_mixed(benchmark::State& state) {
+  std::string payload;
+  payload.reserve(static_cast<std::size_t>(state.range(0)));
+  while (payload.size() < static_cast<std::size_t>(state.range(0))) {
+    payload += "ascii text \xd0\xbf\xd1\x80\xd0\xb8\xd0\xbc\xd0\xb5\xd1\x80 ";
+  }
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::text::IsUtf8(payload));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(payload.size()));
+}
+BENCHMARK(utf8_validate_mixed)->Arg(64)->Arg(4096)->Arg(65536);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
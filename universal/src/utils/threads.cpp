@@ -17,6 +17,9 @@
 #endif
 
 #include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <string>
 
 #include <fmt/format.h>
 
@@ -32,6 +35,33 @@ namespace {
 pid_t GetTid() { return static_cast<pid_t>(syscall(SYS_gettid)); }
 #endif
 
+thread_local int current_thread_numa_node = 0;
+
+#ifdef __linux__
+// Parses a sysfs cpulist, e.g. "0-15,32-47", into a cpu_set_t.
+cpu_set_t ParseCpuList(const std::string& cpulist) {
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  std::size_t pos = 0;
+  while (pos < cpulist.size()) {
+    std::size_t end = 0;
+    const int first = std::stoi(cpulist.substr(pos), &end);
+    pos += end;
+    int last = first;
+    if (pos < cpulist.size() && cpulist[pos] == '-') {
+      ++pos;
+      last = std::stoi(cpulist.substr(pos), &end);
+      pos += end;
+    }
+    for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu) {
+      CPU_SET(cpu, &cpuset);
+    }
+    if (pos < cpulist.size() && cpulist[pos] == ',') ++pos;
+  }
+  return cpuset;
+}
+#endif
+
 int QueryLowPriorityParam() {
   // -20 - highest priority, 19 - lowest priority
   constexpr int kLowestPriority = 19;
@@ -79,6 +109,66 @@ void SetCurrentThreadLowPriorityScheduling() {
                       "setting thread scheduling parameters");
 }
 
+void SetCurrentThreadNumaNode(int node) {
+#ifdef __linux__
+  const auto cpulist_path =
+      fmt::format("/sys/devices/system/node/node{}/cpulist", node);
+  std::ifstream cpulist_file(cpulist_path);
+  std::string cpulist;
+  if (!std::getline(cpulist_file, cpulist) || cpulist.empty()) {
+    throw std::runtime_error(fmt::format(
+        "Failed to read '{}', is NUMA node {} present?", cpulist_path, node));
+  }
+
+  const auto cpuset = ParseCpuList(cpulist);
+  utils::CheckSyscall(::sched_setaffinity(0, sizeof(cpuset), &cpuset),
+                      "pinning thread to NUMA node {}", node);
+  current_thread_numa_node = node;
+#else
+  static_cast<void>(node);
+#endif
+}
+
+int GetCurrentThreadNumaNode() noexcept { return current_thread_numa_node; }
+
+void SetCurrentThreadCpuAffinity(const std::vector<int>& cpus) {
+#ifdef __linux__
+  if (cpus.empty()) return;
+
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  for (const int cpu : cpus) {
+    if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &cpuset);
+  }
+  utils::CheckSyscall(::sched_setaffinity(0, sizeof(cpuset), &cpuset),
+                      "pinning thread to the configured CPU set");
+#else
+  static_cast<void>(cpus);
+#endif
+}
+
+std::size_t GetNumaNodeCount() noexcept {
+#ifdef __linux__
+  static const std::size_t count = [] {
+    std::ifstream possible_file("/sys/devices/system/node/possible");
+    std::string possible;
+    if (!std::getline(possible_file, possible) || possible.empty()) return 1UL;
+    const auto dash_pos = possible.find('-');
+    try {
+      const auto last = std::stoul(
+          dash_pos == std::string::npos ? possible
+                                        : possible.substr(dash_pos + 1));
+      return last + 1;
+    } catch (const std::exception&) {
+      return 1UL;
+    }
+  }();
+  return count;
+#else
+  return 1;
+#endif
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END